@@ -0,0 +1,251 @@
+"""
+Microbenchmark harness.
+
+Each benchmark is a function without arguments that is called repeatedly.
+The harness warms up the function (caches, lazily created tables), calibrates
+the number of calls per repetition to a minimum duration, and measures several
+repetitions. Results are summarized statistically per item (e.g., per state
+for batch operations) and can be saved as JSON file. Comparing results with a
+saved baseline decides whether a change of the engine is accepted or rejected.
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+import gc
+import json
+import math
+import platform
+import statistics
+import time
+import numpy as np
+
+class Benchmark:
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, warmup_s=0.2, repeat=7, min_time_s=0.1, name_filter=None):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        warmup_s : float, optional
+            Minimum time in seconds to call a function before measuring. (Default: 0.2)
+        repeat : int, optional
+            Number of measured repetitions. (Default: 7)
+        min_time_s : float, optional
+            Minimum duration of a single repetition in seconds. (Default: 0.1)
+        name_filter : string, optional
+            Run only benchmarks whose key 'group/name' contains this string. (Default: None)
+
+        Returns
+        -------
+        None.
+
+        """
+        assert repeat >= 2
+        self.warmup_s = warmup_s
+        self.repeat = repeat
+        self.min_time_s = min_time_s
+        self.name_filter = name_filter
+        self.results = []
+
+    # ========== Measure ======================================================
+
+    def run(self, name, function, items_per_call=1, group=''):
+        """
+        Measure a function and store the result.
+
+        Parameters
+        ----------
+        name : string
+            Name of the benchmark (unique within its group, used to compare with baselines).
+        function : function
+            Function without arguments to measure.
+        items_per_call : int, optional
+            Number of items (e.g., states in a batch) processed by one call. (Default: 1)
+        group : string, optional
+            Group (e.g., implementation or backend) the benchmark belongs to. (Default: '')
+
+        Returns
+        -------
+        dict or None
+            Summary of the measurement (refer to _summarize()), None if filtered out.
+
+        """
+        if (self.name_filter is not None) and (self.name_filter not in f'{group}/{name}'):
+            return None
+
+        # Warm up and calibrate calls per repetition
+        number_calls = 1
+        start_time_ns = time.perf_counter_ns()
+        while True:
+            elapsed_s = Benchmark._time_calls(function, number_calls) / 1e9
+            if elapsed_s >= self.min_time_s:
+                if (time.perf_counter_ns() - start_time_ns) / 1e9 >= self.warmup_s:
+                    break
+            else:
+                number_calls *= 2 if elapsed_s <= 0.0 else max(2, math.ceil(1.2 * self.min_time_s / elapsed_s))
+
+        # Measure repetitions (time per item in nanoseconds)
+        samples = [Benchmark._time_calls(function, number_calls) / (number_calls * items_per_call)
+                   for _ in range(self.repeat)]
+
+        result = Benchmark._summarize(name, group, samples, number_calls, items_per_call)
+        self.results.append(result)
+        print(Benchmark._format_result(result), flush=True)
+        return result
+
+    # -------------------------------------------------------------------------
+
+    def _time_calls(function, number_calls):
+        """
+        Time calls of a function in nanoseconds (garbage collection disabled).
+        """
+        is_gc_enabled = gc.isenabled()
+        gc.disable()
+        try:
+            start_time_ns = time.perf_counter_ns()
+            for _ in range(number_calls):
+                function()
+            return time.perf_counter_ns() - start_time_ns
+        finally:
+            if is_gc_enabled:
+                gc.enable()
+
+    # -------------------------------------------------------------------------
+
+    def _summarize(name, group, samples, number_calls, items_per_call):
+        """
+        Statistical summary of the samples (times per item in nanoseconds).
+
+        Returns
+        -------
+        dict
+            Name, group, calls per repetition, items per call, samples, and
+            mean, standard deviation, min, median, max, 95 % confidence interval
+            of the mean (all ns per item), and items per second (from median).
+
+        """
+        mean = statistics.fmean(samples)
+        stdev = statistics.stdev(samples)
+        median = statistics.median(samples)
+        return {
+            'name': name,
+            'group': group,
+            'calls_per_repeat': number_calls,
+            'items_per_call': items_per_call,
+            'samples_ns': samples,
+            'mean_ns': mean,
+            'stdev_ns': stdev,
+            'min_ns': min(samples),
+            'median_ns': median,
+            'max_ns': max(samples),
+            'ci95_ns': 1.96 * stdev / math.sqrt(len(samples)),
+            'items_per_s': 1e9 / median if median > 0 else math.inf
+        }
+
+    # ========== Output =======================================================
+
+    def _format_time(time_ns):
+        """
+        Format a duration with suitable unit.
+        """
+        for unit, scale in (('s', 1e9), ('ms', 1e6), ('us', 1e3)):
+            if time_ns >= scale:
+                return f'{time_ns / scale:7.2f} {unit} '
+        return f'{time_ns:7.1f} ns '
+
+    def _format_result(result):
+        """
+        Format a result as single line.
+        """
+        relative_stdev = 100.0 * result['stdev_ns'] / result['mean_ns'] if result['mean_ns'] > 0 else 0.0
+        return (f"{Benchmark._key(result):<48}"
+                f"median {Benchmark._format_time(result['median_ns'])}"
+                f"min {Benchmark._format_time(result['min_ns'])}"
+                f"+/- {relative_stdev:4.1f} %  "
+                f"({result['items_per_s']:_.0f} items/s)")
+
+    # -------------------------------------------------------------------------
+
+    def machine_info():
+        """
+        Get information on machine and software versions (stored with results).
+        """
+        return {
+            'platform': platform.platform(),
+            'processor': platform.processor(),
+            'python': platform.python_version(),
+            'implementation': platform.python_implementation(),
+            'numpy': np.__version__,
+            'timestamp': time.strftime('%Y-%m-%dT%H:%M:%S')
+        }
+
+    # -------------------------------------------------------------------------
+
+    def save_to_file(self, file_name):
+        """
+        Save machine information, settings, and results as JSON file.
+        """
+        data = {
+            'machine': Benchmark.machine_info(),
+            'settings': {'warmup_s': self.warmup_s, 'repeat': self.repeat, 'min_time_s': self.min_time_s},
+            'results': self.results
+        }
+        with open(file_name, 'w') as file:
+            json.dump(data, file, indent=2)
+
+    # ========== Compare with baseline ========================================
+
+    def compare(self, baseline_file, threshold=0.05):
+        """
+        Compare the results with a baseline saved by save_to_file().
+
+        A benchmark regresses if its median per item is more than threshold
+        slower than the baseline median and the difference exceeds the noise
+        (sum of both 95 % confidence intervals).
+
+        Parameters
+        ----------
+        baseline_file : string
+            JSON file containing the baseline results.
+        threshold : float, optional
+            Tolerated relative slowdown. (Default: 0.05, i.e., 5 %)
+
+        Returns
+        -------
+        list(string)
+            Keys 'group/name' of regressed benchmarks (empty if the change is accepted).
+
+        """
+        with open(baseline_file, 'r') as file:
+            baseline = {Benchmark._key(result): result for result in json.load(file)['results']}
+
+        print(f'\nComparison with baseline {baseline_file}:')
+        regressions = []
+        for result in self.results:
+            key = Benchmark._key(result)
+            if key not in baseline:
+                continue
+            base = baseline[key]
+            ratio = result['median_ns'] / base['median_ns']
+            noise = result['ci95_ns'] + base['ci95_ns']
+            is_regression = (ratio > 1.0 + threshold) and (result['median_ns'] - base['median_ns'] > noise)
+            if is_regression:
+                regressions.append(key)
+            print(f"{key:<48}{100.0 * (ratio - 1.0):+7.1f} %{'  REGRESSION' if is_regression else ''}")
+
+        return regressions
+
+    # -------------------------------------------------------------------------
+
+    def _key(result):
+        """
+        Unique key 'group/name' of a result.
+        """
+        return f"{result['group']}/{result['name']}"
@@ -0,0 +1,147 @@
+"""
+Microbenchmarks of the cube state engines.
+
+Benchmarks are grouped by implementation:
+- pocket: Pocket cube state (PCubeState), environment, and sample policy
+- rubik: Rubik's cube state objects (RCubeState, reference implementation)
+- rubik-batch: Rubik's cube coordinate arrays (vectorized backend, times per state)
+
+Usage examples (from this directory):
+    python CubeBenchmarks.py --output base.json
+    python CubeBenchmarks.py --baseline base.json --threshold 0.05
+
+With a baseline, the script exits with code 1 if any benchmark regressed, so
+that engine changes are accepted or rejected based on the numbers.
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add cube environments and models to path
+import os
+import sys
+src_dir = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+sys.path.append(os.path.join(src_dir, 'pocket_cube_gym'))
+sys.path.append(os.path.join(src_dir, 'rubik_cube_gym'))
+sys.path.append(os.path.join(src_dir, 'pocket_cube_models', 'sample'))
+
+# Other imports
+import argparse
+import random
+import numpy as np
+from Benchmark import Benchmark
+from PCubeAction import Action
+
+# -----------------------------------------------------------------------------
+# Benchmarks
+# -----------------------------------------------------------------------------
+
+def scrambled_state(state, number_moves):
+    """
+    Apply random actions to a state object.
+    """
+    for _ in range(number_moves):
+        state = state.next_state(random.choice(list(Action)))
+    return state
+
+# -----------------------------------------------------------------------------
+
+def run_pocket(benchmark):
+    """
+    Pocket cube state, environment, and sample policy.
+    """
+    from PCubeState import State
+    state = scrambled_state(State(), 20)
+    states = [scrambled_state(State(), 20) for _ in range(12)]
+    dst = np.zeros((8, 24), dtype=np.float32)
+
+    benchmark.run('next_state', lambda: state.next_state(Action.R), group='pocket')
+    benchmark.run('is_cube_solved', state.is_cube_solved, group='pocket')
+    benchmark.run('one_hot_encoding', state.one_hot_encoding, group='pocket')
+    benchmark.run('one_hot_encoding_dst', lambda: state.one_hot_encoding(dst), group='pocket')
+    benchmark.run('one_hot_encode_states_12', lambda: State.one_hot_encode_states(states), 12, group='pocket')
+
+    # Environment (requires gym)
+    from PocketCubeEnv import PocketCubeEnv
+    env = PocketCubeEnv(render_mode=None)
+
+    def scramble():
+        env.reset()
+        env.scramble(10)
+
+    benchmark.run('env_scramble_10', scramble, group='pocket')
+    benchmark.run('env_explore_state', lambda: env.explore_state(state, encoded=False), group='pocket')
+    benchmark.run('env_explore_state_encoded', lambda: env.explore_state(state, encoded=True), group='pocket')
+
+    # Policy lookups (table filled with states of up to 8 scrambles)
+    from SamplePolicy import Policy
+    policy = Policy(len(Action))
+    known_states = [scrambled_state(State(), random.randint(1, 8)) for _ in range(10_000)]
+    for known_state in known_states:
+        policy.add(known_state, random.choice(list(Action)), random.randint(1, 50))
+    known_state = known_states[0]
+
+    benchmark.run('policy_max_rewards', lambda: policy.max_rewards(known_state), group='pocket')
+    benchmark.run('policy_best_action', lambda: policy.best_action(known_state), group='pocket')
+
+# -----------------------------------------------------------------------------
+
+def run_rubik(benchmark, batch_size):
+    """
+    Rubik's cube state objects and coordinate arrays.
+    """
+    from RCubeState import State
+    state = scrambled_state(State(), 30)
+    states = [scrambled_state(State(), 30) for _ in range(12)]
+
+    # Reference implementation (state objects)
+    benchmark.run('next_state', lambda: state.next_state(Action.R), group='rubik')
+    benchmark.run('is_cube_solved', state.is_cube_solved, group='rubik')
+    benchmark.run('one_hot_encoding', state.one_hot_encoding, group='rubik')
+    benchmark.run('one_hot_encode_states_12', lambda: State.one_hot_encode_states(states), 12, group='rubik')
+    benchmark.run('get_coordinates', state.get_coordinates, group='rubik')
+
+    # Vectorized backend (coordinate arrays)
+    coordinates = State.to_coordinate_array([scrambled_state(State(), 30) for _ in range(1_000)])
+    coordinates = np.tile(coordinates, (1, batch_size // 1_000 + 1))[:, :batch_size].copy()
+    actions = np.random.randint(0, 12, size=batch_size).astype(np.int32)
+    out = np.empty_like(coordinates)
+
+    benchmark.run('batch_next_coordinates', lambda: State.next_coordinates(coordinates, actions, out), batch_size, group='rubik-batch')
+    benchmark.run('batch_are_solved', lambda: State.are_solved_coordinates(coordinates), batch_size, group='rubik-batch')
+    benchmark.run('batch_successors', lambda: State.successor_coordinates(coordinates), batch_size, group='rubik-batch')
+
+# -----------------------------------------------------------------------------
+# Main
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Microbenchmarks of the cube state engines.')
+    parser.add_argument('--output', help='save results to JSON file')
+    parser.add_argument('--baseline', help='compare with results in JSON file')
+    parser.add_argument('--threshold', type=float, default=0.05, help='tolerated relative slowdown (default: 0.05)')
+    parser.add_argument('--filter', help='run benchmarks whose name contains this string only')
+    parser.add_argument('--repeat', type=int, default=7, help='number of measured repetitions (default: 7)')
+    parser.add_argument('--batch-size', type=int, default=65_536, help='batch size of vectorized benchmarks')
+    parser.add_argument('--quick', action='store_true', help='short warm-up and repetitions (smoke test)')
+    args = parser.parse_args()
+
+    random.seed(0)
+    np.random.seed(0)
+    if args.quick:
+        benchmark = Benchmark(warmup_s=0.01, repeat=3, min_time_s=0.01, name_filter=args.filter)
+    else:
+        benchmark = Benchmark(repeat=args.repeat, name_filter=args.filter)
+
+    run_pocket(benchmark)
+    run_rubik(benchmark, args.batch_size)
+
+    if args.output is not None:
+        benchmark.save_to_file(args.output)
+    if args.baseline is not None:
+        regressions = benchmark.compare(args.baseline, args.threshold)
+        print(f'\n{len(regressions)} regression(s): change ' + ('rejected' if regressions else 'accepted'))
+        sys.exit(1 if regressions else 0)
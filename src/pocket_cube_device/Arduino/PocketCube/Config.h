@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/cubes
  * Copyright: 2023, Marc Hensel
- * Version: 2023.07.29
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************/
 
@@ -49,4 +49,11 @@
 #define TURN_DELAY_MS 550       // Delay for each direction (forward, backward)
 #define ROTATE_DELAY_MS 650     // Delay for each 90° turn
 
+/*****************************************************************************************************
+ * Latency breakdown (see Trace.h)
+ *****************************************************************************************************/
+
+#define TRACE_ENABLED 1         // Record timed events of received commands (0: disabled)
+#define TRACE_BUFFER_SIZE 32    // Number of events stored in ring buffer (9 bytes RAM each, older events are dropped)
+
 #endif
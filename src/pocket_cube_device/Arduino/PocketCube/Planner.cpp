@@ -0,0 +1,62 @@
+/*****************************************************************************************************
+ * Servo programs of face rotations planned on the device ('SpiCor' mode).
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/cubes
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************
+ * Same logic as PocketCube.rotateCube() in 'SpiCor' mode: The cube is not brought back into its
+ * standard orientation after a rotation. Instead, the locations of the logical faces front, right,
+ * and up are tracked, and a logical rotation is mapped to the face at its current location.
+ *****************************************************************************************************/
+
+#include <Arduino.h>
+#include "Planner.h"
+
+/*****************************************************************************************************
+ * Methods
+ *****************************************************************************************************/
+
+/**! Set the logical faces to the standard orientation (e.g., after scanning the cube).
+ */
+void Planner::reset(void) {
+  orientationFront = 0;
+  orientationRight = 2;
+  orientationUp = 4;
+}
+
+/**! Get the servo commands of a logical rotation and update the locations of the faces.
+ * 
+ * @param rotation [in] Logical rotation (3 * face + turn, see SolverTables.h)
+ * @return servo commands (valid until the next call)
+ */
+const char* Planner::servoCommands(uint8_t rotation) {
+  // Face at the location of the logical face (D, B, L: opposite of U, F, R)
+  uint8_t logicalFace = rotation / 3;
+  uint8_t orientation = (logicalFace < 2) ? orientationUp : ((logicalFace < 4) ? orientationFront : orientationRight);
+  uint8_t face = pgm_read_byte(&ORIENTATION_FACES[orientation]) ^ (logicalFace & 1);
+  uint8_t relativeRotation = 3 * face + rotation % 3;
+
+  // Servo commands and new locations of the faces
+  strcpy_P(commands, SERVO_COMMANDS[relativeRotation]);
+  orientationFront = pgm_read_byte(&NEXT_ORIENTATIONS[orientationFront][relativeRotation]);
+  orientationRight = pgm_read_byte(&NEXT_ORIENTATIONS[orientationRight][relativeRotation]);
+  orientationUp = pgm_read_byte(&NEXT_ORIENTATIONS[orientationUp][relativeRotation]);
+  return commands;
+}
+
+/**! Get the name of a rotation as used by PocketCube.py (e.g., "U", "u", "U2").
+ * 
+ * @param rotation [in] Rotation (3 * face + turn)
+ * @param name [out] Name (null-terminated)
+ */
+void Planner::rotationName(uint8_t rotation, char name[3]) {
+  static const char faces[] = "UDFBRL";
+  char face = faces[rotation / 3];
+  uint8_t turn = rotation % 3;
+  name[0] = (turn == 1) ? face - 'A' + 'a' : face;
+  name[1] = (turn == 2) ? '2' : '\0';
+  name[2] = '\0';
+}
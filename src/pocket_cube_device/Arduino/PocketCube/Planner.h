@@ -0,0 +1,37 @@
+/*****************************************************************************************************
+ * Servo programs of face rotations planned on the device ('SpiCor' mode).
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/cubes
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#ifndef _PLANNER_H_
+#define _PLANNER_H_
+
+#include <Arduino.h>
+#include "SolverTables.h"
+
+class Planner {
+
+  /*****************************************************************************************************
+   * Attributes
+   *****************************************************************************************************/
+  private:
+    uint8_t orientationFront = 0;   // Location of the logical front face (+x)
+    uint8_t orientationRight = 2;   // Location of the logical right face (+y)
+    uint8_t orientationUp = 4;      // Location of the logical up face (+z)
+    char commands[SERVO_COMMAND_LENGTH];
+
+  /*****************************************************************************************************
+   * Methods
+   *****************************************************************************************************/
+  public:
+    void reset(void);
+    const char* servoCommands(uint8_t rotation);
+    static void rotationName(uint8_t rotation, char name[3]);
+};
+
+#endif
@@ -4,7 +4,7 @@
  * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
  * Project: https://github.com/MarcOnTheMoon/cubes
  * Copyright: 2023, Marc Hensel
- * Version: 2023.07.29
+ * Version: 2026.10.18
  * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
  *****************************************************************************************************
  * Board:
@@ -17,10 +17,22 @@
  * 
  * Servos used and calibration procedure:
  * - See file Servos.cpp
+ * 
+ * Commands received via the serial interface:
+ * - 'I', 'L', 'R', 'T': Init servos, rotate left or right, turn cube vertically
+ * - '>': Acknowledge ("ok")
+ * - '?': Send recorded events (see Trace.h)
+ * - 'P' followed by 10 hex digits: Solve the packed state (see Solver.cpp) on the device, send
+ *   "solution <rotations>" (or "error"), and execute the servo program
+ *
+ * Build and run on Linux with stand-ins for the servo board and serial port (see linux/Arduino.h).
  *****************************************************************************************************/
 
 #include "Servos.h"
 #include "SerialCom.h"
+#include "Trace.h"
+#include "Solver.h"
+#include "Planner.h"
 
 /*****************************************************************************************************
  * Global variables
@@ -28,6 +40,72 @@
 
 SerialCom serialCom;
 Servos servos;
+Trace trace;
+Solver solver;
+Planner planner;
+
+/*****************************************************************************************************
+ * Commands
+ *****************************************************************************************************/
+
+/* Execute a single-character command */
+void execute(char command) {
+  unsigned long startUs = micros();
+  switch (command) {
+    case 'I':                   // Init
+      servos.initPositions();
+      break;
+    case 'L':                   // Left (horizontal)
+      servos.rotateLeft();
+      break;
+    case 'R':                   // Right (horizontal)
+      servos.rotateRight();
+      break;
+    case 'T':                   // Turn vertically
+      servos.turnCube();
+      break;
+    case '>':                   // Send acqknowledge
+      Serial.println("ok");
+      break;
+    case '?':                   // Send recorded events (latency breakdown)
+      trace.dump();
+      break;
+  }
+  if (strchr("ILRT>", command) != NULL) {
+    trace.record(command, startUs, micros());
+  }
+}
+
+/* Solve a packed state and execute the servo program */
+void solvePackedState(const char *hex) {
+  unsigned long startUs = micros();
+  uint8_t positions[8], orientations[8], rotations[SOLVER_MAX_LENGTH];
+  int length = solver.unpack(hex, positions, orientations) ? solver.solve(positions, orientations, rotations) : -1;
+  trace.record('P', startUs, micros());
+  if (length < 0) {
+    Serial.println("error");
+    return;
+  }
+
+  // Send solution (e.g., "solution R u F2")
+  char name[3];
+  Serial.print("solution");
+  for (int i = 0; i < length; i++) {
+    Planner::rotationName(rotations[i], name);
+    Serial.print(' ');
+    Serial.print(name);
+  }
+  Serial.println();
+
+  // Plan and execute servo commands (cube is in standard orientation when scanned)
+  planner.reset();
+  for (int i = 0; i < length; i++) {
+    const char *commands = planner.servoCommands(rotations[i]);
+    while (*commands != '\0') {
+      execute(*commands++);
+    }
+  }
+}
 
 /*****************************************************************************************************
  * Standard methods
@@ -51,28 +129,19 @@ void loop() {
   // Read data sent from Python script
   char *receivedData;
   int receivedCount;
+  unsigned long startUs = micros();
   
   receivedData = serialCom.receive(&receivedCount);
 
   // React on received data
   if (receivedCount > 0) {
+    trace.record('<', startUs, micros());
     for (int i = 0; i < receivedCount; i++) {
-      switch (receivedData[i]) {
-        case 'I':                   // Init
-          servos.initPositions();
-          break;
-        case 'L':                   // Left (horizontal)
-          servos.rotateLeft();
-          break;
-        case 'R':                   // Right (horizontal)
-          servos.rotateRight();
-          break;
-        case 'T':                   // Turn vertically
-          servos.turnCube();
-          break;
-        case '>':                   // Send acqknowledge
-          Serial.println("ok");
-          break;
+      if ((receivedData[i] == 'P') && (i + PACKED_STATE_LENGTH < receivedCount)) {
+        solvePackedState(receivedData + i + 1);
+        i += PACKED_STATE_LENGTH;
+      } else {
+        execute(receivedData[i]);
       }
     }
   }
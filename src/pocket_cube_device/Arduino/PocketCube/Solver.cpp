@@ -0,0 +1,182 @@
+/*****************************************************************************************************
+ * Pocket cube solver running on the device (IDA* with pattern databases in flash).
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/cubes
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************
+ * States are sent by the host as 10 hex digits (5 bytes, least significant byte first):
+ * - Bits 3 * i to 3 * i + 2: Cubie at position i (i = 0..7)
+ * - Bits 24 + 2 * i to 24 + 2 * i + 1: Orientation at position i
+ * 
+ * The state is rotated as a whole so that cubie 7 is at position 7 with orientation 0 (canonical
+ * frame, see PCubeCode.py). The faces R, U, F do not move position 7. Hence, IDA* searches turns
+ * of these faces only (9 moves: quarter and half turns) and estimates the remaining number of turns
+ * by the maximum of two pattern databases (positions and orientations, see SolverTables.h). The
+ * solution is mapped back to the faces of the original frame, which equal R, U, F in the canonical
+ * frame.
+ *****************************************************************************************************/
+
+#include <Arduino.h>
+#include "Solver.h"
+#include "SolverTables.h"
+
+/*****************************************************************************************************
+ * Packed states
+ *****************************************************************************************************/
+
+/**! Unpack a state sent as hex digits.
+ * 
+ * @param hex [in] PACKED_STATE_LENGTH hex digits
+ * @param statePositions [out] Cubie at each position
+ * @param stateOrientations [out] Orientation at each position
+ * @return true if the state is valid, else false
+ */
+bool Solver::unpack(const char *hex, uint8_t statePositions[8], uint8_t stateOrientations[8]) {
+  uint8_t bytes[PACKED_STATE_LENGTH / 2];
+  for (uint8_t i = 0; i < PACKED_STATE_LENGTH; i++) {
+    char c = hex[i];
+    uint8_t digit;
+    if ((c >= '0') && (c <= '9'))
+      digit = c - '0';
+    else if ((c >= 'A') && (c <= 'F'))
+      digit = c - 'A' + 10;
+    else if ((c >= 'a') && (c <= 'f'))
+      digit = c - 'a' + 10;
+    else
+      return false;
+    bytes[i / 2] = (i % 2 == 0) ? (digit << 4) : (bytes[i / 2] | digit);
+  }
+
+  // Positions (3 bits each) and orientations (2 bits each)
+  uint32_t positionBits = bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16);
+  uint16_t orientationBits = bytes[3] | ((uint16_t)bytes[4] << 8);
+  uint8_t usedCubies = 0, twist = 0;
+  for (uint8_t i = 0; i < 8; i++) {
+    statePositions[i] = (positionBits >> (3 * i)) & 7;
+    stateOrientations[i] = (orientationBits >> (2 * i)) & 3;
+    usedCubies |= 1 << statePositions[i];
+    twist += stateOrientations[i];
+    if (stateOrientations[i] > 2)
+      return false;
+  }
+  return (usedCubies == 0xFF) && (twist % 3 == 0);
+}
+
+/*****************************************************************************************************
+ * Solve
+ *****************************************************************************************************/
+
+/**! Find a solution with the minimum number of face turns (quarter and half turns).
+ * 
+ * @param statePositions [in] Cubie at each position
+ * @param stateOrientations [in] Orientation at each position
+ * @param rotations [out] Rotations (3 * face + turn, see SolverTables.h), at least SOLVER_MAX_LENGTH
+ * @return number of rotations, or -1 if no solution has been found
+ */
+int Solver::solve(const uint8_t statePositions[8], const uint8_t stateOrientations[8], uint8_t *rotations) {
+  // Frame of the state (position and orientation of cubie 7)
+  uint8_t position7 = 0;
+  while (statePositions[position7] != 7)
+    position7++;
+  uint8_t frame = 3 * position7 + stateOrientations[position7];
+
+  // Rotate state to the canonical frame
+  for (uint8_t i = 0; i < 7; i++) {
+    uint8_t from = pgm_read_byte(&FRAME_POSITIONS[frame][i]);
+    positions[0][i] = statePositions[from];
+    orientations[0][i] = (stateOrientations[from] + pgm_read_byte(&FRAME_ORIENTATIONS[frame][i])) % 3;
+  }
+
+  // Iterative deepening
+  numberNodes = 0;
+  for (uint8_t maxDepth = distance(0); maxDepth <= SOLVER_MAX_LENGTH; maxDepth++) {
+    if (search(0, maxDepth, -1)) {
+      for (uint8_t i = 0; i < solutionLength; i++) {
+        uint8_t face = pgm_read_byte(&FRAME_FACES[frame][moves[i] / 3]);
+        rotations[i] = 3 * face + moves[i] % 3;
+      }
+      return solutionLength;
+    }
+  }
+  return -1;
+}
+
+/**! Depth-first search of solutions with at most maxDepth turns.
+ * 
+ * @param depth [in] Number of turns of the current path
+ * @param maxDepth [in] Maximum number of turns
+ * @param lastFace [in] Face turned last (not turned again), or -1
+ * @return true if a solution has been found, else false
+ */
+bool Solver::search(uint8_t depth, uint8_t maxDepth, int8_t lastFace) {
+  numberNodes++;
+  uint8_t estimate = distance(depth);
+  if (estimate == 0) {
+    solutionLength = depth;
+    return true;
+  }
+  if (depth + estimate > maxDepth)
+    return false;
+
+  const uint8_t *from = positions[depth];
+  for (int8_t face = 0; face < 3; face++) {
+    if (face == lastFace)
+      continue;
+    for (uint8_t turn = 0; turn < 3; turn++) {
+      uint8_t move = 3 * face + turn;
+      for (uint8_t i = 0; i < 7; i++) {
+        uint8_t source = pgm_read_byte(&MOVE_POSITIONS[move][i]);
+        positions[depth + 1][i] = from[source];
+        orientations[depth + 1][i] = (orientations[depth][source] + pgm_read_byte(&MOVE_ORIENTATIONS[move][i])) % 3;
+      }
+      moves[depth] = move;
+      if (search(depth + 1, maxDepth, face))
+        return true;
+    }
+  }
+  return false;
+}
+
+/*****************************************************************************************************
+ * Pattern databases
+ *****************************************************************************************************/
+
+/**! Get the lower bound of the number of turns solving the state at a depth of the search.
+ * 
+ * @param depth [in] Depth of the state
+ * @return maximum of the position and orientation distance
+ */
+uint8_t Solver::distance(uint8_t depth) {
+  const uint8_t *p = positions[depth];
+  const uint8_t *o = orientations[depth];
+
+  // Lexicographic rank of the permutation of cubies 0..6
+  uint16_t rank = 0;
+  for (uint8_t i = 0; i < 6; i++) {
+    uint8_t smaller = 0;
+    for (uint8_t j = i + 1; j < 7; j++) {
+      if (p[j] < p[i])
+        smaller++;
+    }
+    rank = rank * (7 - i) + smaller;
+  }
+
+  // Orientations of positions 0..5 in base 3
+  uint16_t twist = 0;
+  for (uint8_t i = 0; i < 6; i++)
+    twist = 3 * twist + o[i];
+
+  uint8_t positionDistance = readNibble(POSITION_DISTANCES, rank);
+  uint8_t orientationDistance = readNibble(ORIENTATION_DISTANCES, twist);
+  return (positionDistance > orientationDistance) ? positionDistance : orientationDistance;
+}
+
+/**! Read an entry of a table in flash storing two entries per byte.
+ */
+uint8_t Solver::readNibble(const uint8_t *table, uint16_t index) {
+  uint8_t entries = pgm_read_byte(table + (index >> 1));
+  return (index & 1) ? (entries >> 4) : (entries & 0x0F);
+}
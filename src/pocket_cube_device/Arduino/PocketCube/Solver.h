@@ -0,0 +1,46 @@
+/*****************************************************************************************************
+ * Pocket cube solver running on the device (IDA* with pattern databases in flash).
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/cubes
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#ifndef _SOLVER_H_
+#define _SOLVER_H_
+
+#include <Arduino.h>
+
+#define SOLVER_MAX_LENGTH 11        // Maximum number of face turns (quarter and half turns) of solutions
+#define PACKED_STATE_LENGTH 10      // Hex digits of packed states
+
+class Solver {
+
+  /*****************************************************************************************************
+   * Attributes
+   *****************************************************************************************************/
+  public:
+    unsigned long numberNodes = 0;  // Number of states visited by the last search
+
+  private:
+    uint8_t positions[SOLVER_MAX_LENGTH + 1][7];      // Cubie at positions 0..6 (canonical frame) per depth
+    uint8_t orientations[SOLVER_MAX_LENGTH + 1][7];   // Orientation at positions 0..6 per depth
+    uint8_t moves[SOLVER_MAX_LENGTH];                 // Solver moves (3 * face + turn) of the current path
+    uint8_t solutionLength = 0;                       // Number of moves of the solution found
+
+  /*****************************************************************************************************
+   * Methods
+   *****************************************************************************************************/
+  public:
+    bool unpack(const char *hex, uint8_t statePositions[8], uint8_t stateOrientations[8]);
+    int solve(const uint8_t statePositions[8], const uint8_t stateOrientations[8], uint8_t *rotations);
+
+  private:
+    bool search(uint8_t depth, uint8_t maxDepth, int8_t lastFace);
+    uint8_t distance(uint8_t depth);
+    static uint8_t readNibble(const uint8_t *table, uint16_t index);
+};
+
+#endif
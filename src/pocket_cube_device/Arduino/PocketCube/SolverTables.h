@@ -0,0 +1,295 @@
+/*****************************************************************************************************
+ * Tables of the Pocket cube solver (generated by SolverTables.py, do not edit).
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/cubes
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************
+ * Pattern databases (two entries per byte, entry i in byte i / 2, low nibble first):
+ * - POSITION_DISTANCES: Face turns to solve the positions of cubies 0..6 by permutation rank
+ * - ORIENTATION_DISTANCES: Face turns to solve the orientations of positions 0..5 (base 3)
+ *
+ * Rotations are indexed by 3 * face + turn with faces "UDFBRL" and turns (90°, -90°, 180°).
+ *****************************************************************************************************/
+
+#ifndef _SOLVER_TABLES_H_
+#define _SOLVER_TABLES_H_
+
+#include <Arduino.h>
+
+#define NUMBER_POSITION_RANKS 5040
+#define NUMBER_ORIENTATION_CODES 729
+#define NUMBER_SOLVER_MOVES 9
+#define NUMBER_FRAMES 24
+#define NUMBER_ROTATIONS 18
+#define SERVO_COMMAND_LENGTH 9
+
+/*****************************************************************************************************
+ * Pattern databases
+ *****************************************************************************************************/
+
+const uint8_t POSITION_DISTANCES[(NUMBER_POSITION_RANKS + 1) / 2] PROGMEM = {
+  112, 103, 102, 86, 53, 85, 85, 87, 86, 83, 101, 85, 71, 85, 85, 101, 87, 53, 83, 85, 85, 85, 99, 86,
+  101, 83, 85, 55, 85, 84, 85, 70, 85, 101, 86, 85, 87, 53, 101, 69, 102, 53, 102, 99, 102, 85, 86, 69,
+  53, 101, 85, 85, 118, 67, 84, 86, 101, 85, 102, 52, 87, 68, 84, 69, 101, 86, 101, 83, 86, 86, 69, 101,
+  86, 69, 84, 101, 82, 85, 85, 54, 68, 68, 70, 86, 100, 102, 84, 85, 70, 70, 69, 101, 101, 100, 84, 68,
+  85, 68, 101, 67, 102, 85, 69, 86, 69, 85, 68, 85, 85, 70, 70, 86, 97, 102, 68, 85, 69, 100, 52, 102,
+  86, 69, 84, 100, 85, 85, 70, 100, 101, 86, 68, 70, 86, 85, 69, 85, 69, 84, 84, 69, 86, 84, 85, 84,
+  86, 53, 101, 68, 69, 86, 100, 85, 68, 85, 84, 85, 85, 86, 85, 102, 83, 69, 70, 85, 84, 99, 85, 84,
+  99, 69, 101, 70, 70, 84, 86, 84, 54, 69, 84, 85, 101, 69, 69, 85, 99, 84, 69, 69, 69, 100, 68, 101,
+  85, 68, 85, 70, 70, 84, 102, 84, 85, 70, 85, 85, 68, 102, 70, 101, 85, 84, 53, 86, 86, 85, 86, 68,
+  84, 102, 83, 85, 53, 86, 86, 84, 84, 85, 69, 85, 86, 84, 70, 83, 69, 68, 85, 70, 85, 85, 84, 86,
+  82, 102, 100, 102, 22, 101, 69, 86, 68, 69, 85, 101, 69, 85, 70, 70, 103, 68, 84, 85, 85, 85, 85, 69,
+  101, 99, 69, 69, 100, 86, 85, 53, 70, 70, 69, 84, 69, 69, 69, 102, 69, 69, 100, 99, 85, 69, 102, 70,
+  84, 100, 84, 70, 86, 68, 84, 53, 101, 101, 102, 84, 85, 67, 84, 68, 102, 101, 86, 85, 52, 70, 68, 101,
+  84, 84, 85, 84, 102, 68, 85, 69, 101, 85, 101, 100, 84, 69, 84, 85, 70, 69, 67, 100, 101, 69, 84, 100,
+  85, 85, 85, 85, 99, 84, 69, 102, 99, 84, 70, 86, 84, 53, 85, 69, 100, 101, 85, 101, 22, 85, 84, 101,
+  71, 69, 84, 100, 101, 85, 85, 83, 102, 86, 85, 70, 85, 86, 69, 69, 52, 101, 85, 85, 70, 100, 69, 85,
+  69, 69, 101, 83, 85, 86, 85, 101, 84, 101, 84, 86, 84, 85, 86, 101, 100, 84, 69, 86, 69, 100, 85, 100,
+  99, 69, 84, 85, 70, 85, 86, 101, 69, 85, 68, 86, 86, 85, 100, 101, 70, 69, 83, 102, 85, 86, 83, 101,
+  97, 118, 86, 70, 69, 68, 69, 70, 85, 84, 102, 68, 70, 68, 69, 86, 83, 86, 69, 85, 86, 70, 85, 86,
+  70, 86, 69, 86, 52, 101, 99, 101, 101, 69, 85, 85, 84, 101, 68, 37, 102, 85, 101, 68, 70, 87, 101, 83,
+  70, 69, 85, 85, 99, 69, 102, 37, 85, 68, 86, 101, 86, 69, 84, 68, 100, 86, 102, 100, 69, 85, 69, 101,
+  86, 70, 53, 99, 86, 100, 101, 68, 101, 68, 101, 53, 83, 85, 70, 69, 68, 84, 101, 69, 85, 53, 85, 101,
+  70, 98, 86, 85, 69, 70, 85, 68, 99, 68, 84, 102, 52, 102, 85, 100, 84, 85, 68, 69, 85, 85, 101, 68,
+  84, 83, 84, 102, 70, 69, 70, 69, 100, 83, 84, 101, 70, 85, 83, 85, 69, 102, 99, 86, 84, 68, 69, 85,
+  69, 85, 69, 102, 99, 53, 37, 101, 102, 86, 101, 85, 102, 70, 100, 68, 102, 84, 85, 98, 68, 85, 70, 69,
+  101, 83, 70, 54, 100, 101, 85, 69, 85, 86, 69, 101, 102, 38, 84, 97, 102, 101, 86, 69, 85, 84, 68, 86,
+  85, 86, 68, 70, 85, 70, 70, 99, 86, 100, 85, 100, 117, 83, 101, 68, 70, 85, 86, 86, 83, 85, 85, 101,
+  68, 70, 85, 116, 68, 85, 101, 70, 53, 68, 85, 102, 69, 69, 101, 86, 53, 70, 84, 85, 100, 70, 85, 101,
+  68, 85, 101, 86, 83, 84, 70, 101, 68, 68, 69, 85, 69, 102, 52, 99, 84, 86, 69, 69, 85, 86, 100, 54,
+  68, 102, 84, 85, 70, 101, 82, 86, 69, 70, 86, 84, 102, 85, 37, 68, 84, 70, 101, 53, 101, 101, 85, 85,
+  86, 69, 101, 101, 99, 85, 86, 54, 85, 68, 86, 101, 70, 85, 84, 52, 85, 70, 86, 83, 86, 86, 69, 100,
+  85, 70, 70, 100, 102, 83, 84, 69, 102, 84, 85, 69, 83, 101, 85, 84, 84, 101, 85, 85, 85, 69, 69, 85,
+  70, 82, 101, 85, 54, 70, 100, 84, 84, 69, 101, 102, 86, 101, 54, 85, 68, 101, 84, 70, 87, 100, 84, 85,
+  86, 53, 101, 99, 86, 100, 70, 84, 101, 85, 69, 71, 68, 85, 102, 85, 68, 101, 85, 100, 69, 84, 85, 101,
+  117, 100, 69, 85, 70, 86, 69, 86, 85, 101, 84, 70, 85, 54, 100, 114, 85, 85, 101, 86, 84, 83, 69, 85,
+  97, 102, 102, 69, 69, 85, 69, 86, 69, 84, 85, 69, 86, 84, 84, 101, 70, 69, 82, 101, 101, 70, 83, 85,
+  101, 98, 86, 70, 85, 84, 84, 70, 85, 84, 70, 101, 102, 53, 85, 69, 85, 69, 86, 98, 85, 84, 86, 85,
+  52, 86, 69, 101, 101, 68, 68, 85, 101, 85, 102, 52, 69, 69, 84, 70, 69, 101, 84, 102, 101, 85, 53, 102,
+  100, 85, 69, 67, 101, 86, 86, 69, 101, 86, 84, 69, 85, 53, 70, 69, 99, 85, 52, 69, 70, 100, 84, 86,
+  53, 101, 101, 84, 85, 85, 100, 85, 82, 84, 85, 86, 84, 99, 52, 69, 85, 85, 101, 85, 54, 53, 100, 85,
+  85, 86, 85, 85, 84, 86, 86, 100, 85, 101, 85, 100, 69, 83, 102, 102, 100, 53, 70, 85, 101, 69, 85, 85,
+  82, 86, 101, 86, 37, 101, 69, 70, 69, 53, 85, 101, 70, 86, 68, 99, 101, 85, 53, 85, 85, 86, 101, 69,
+  102, 69, 69, 69, 68, 70, 84, 99, 84, 85, 53, 100, 84, 85, 68, 100, 101, 69, 54, 86, 85, 102, 85, 70,
+  86, 70, 53, 85, 68, 101, 100, 84, 85, 69, 69, 69, 102, 82, 85, 52, 86, 102, 86, 85, 67, 70, 53, 101,
+  83, 85, 68, 86, 69, 70, 86, 68, 85, 99, 101, 101, 85, 69, 86, 86, 102, 98, 83, 69, 85, 69, 85, 85,
+  97, 102, 87, 70, 70, 84, 84, 86, 69, 68, 101, 68, 86, 69, 84, 84, 70, 70, 67, 86, 84, 85, 82, 101,
+  86, 99, 69, 70, 85, 69, 101, 69, 100, 100, 71, 100, 86, 37, 102, 53, 102, 68, 101, 99, 86, 69, 69, 85,
+  52, 101, 84, 85, 101, 52, 69, 101, 84, 100, 86, 37, 86, 85, 99, 68, 85, 87, 101, 100, 69, 101, 54, 100,
+  87, 84, 85, 86, 83, 86, 85, 53, 85, 53, 87, 101, 115, 101, 100, 101, 54, 69, 52, 101, 101, 85, 83, 84,
+  69, 85, 101, 82, 101, 86, 86, 101, 84, 84, 69, 69, 102, 69, 86, 87, 82, 101, 83, 85, 70, 101, 68, 85,
+  86, 68, 85, 100, 101, 84, 85, 99, 86, 69, 69, 54, 101, 85, 69, 84, 69, 101, 69, 85, 86, 99, 84, 69,
+  85, 69, 100, 68, 84, 101, 85, 100, 83, 100, 69, 70, 100, 85, 102, 101, 100, 68, 69, 86, 85, 100, 100, 99,
+  99, 86, 84, 85, 53, 100, 71, 84, 70, 68, 84, 70, 101, 70, 54, 85, 98, 101, 69, 54, 86, 83, 84, 86,
+  85, 52, 102, 54, 86, 68, 86, 99, 70, 69, 69, 85, 68, 86, 85, 84, 69, 84, 68, 86, 69, 69, 102, 67,
+  84, 102, 67, 100, 52, 101, 69, 69, 69, 70, 84, 70, 101, 68, 69, 83, 85, 52, 101, 53, 100, 100, 68, 86,
+  98, 101, 85, 101, 38, 85, 53, 86, 85, 69, 68, 101, 69, 101, 70, 69, 86, 84, 100, 86, 84, 70, 101, 54,
+  86, 84, 70, 70, 83, 101, 68, 69, 86, 86, 52, 85, 70, 85, 84, 86, 70, 69, 101, 98, 100, 68, 85, 85,
+  83, 100, 69, 53, 86, 84, 83, 70, 85, 85, 86, 84, 86, 83, 69, 67, 85, 86, 102, 85, 68, 54, 68, 84,
+  100, 85, 86, 85, 101, 67, 69, 69, 84, 100, 85, 99, 85, 85, 100, 70, 70, 70, 84, 84, 101, 54, 85, 101,
+  70, 85, 70, 70, 83, 83, 52, 101, 100, 85, 69, 70, 68, 69, 100, 68, 101, 86, 86, 85, 37, 100, 69, 100,
+  70, 69, 84, 86, 86, 37, 101, 83, 117, 68, 102, 84, 68, 86, 86, 102, 97, 86, 54, 102, 68, 84, 69, 69,
+  99, 85, 84, 85, 54, 100, 70, 84, 68, 70, 84, 71, 69, 85, 69, 67, 86, 100, 85, 38, 85, 86, 101, 84,
+  70, 86, 67, 70, 68, 86, 82, 85, 102, 85, 69, 100, 99, 86, 84, 85, 37, 117, 69, 85, 53, 85, 100, 86,
+  86, 85, 53, 71, 86, 83, 99, 84, 86, 86, 85, 70, 101, 114, 85, 84, 101, 102, 101, 69, 69, 86, 84, 83,
+  84, 54, 84, 101, 69, 84, 85, 84, 70, 69, 101, 87, 83, 85, 101, 86, 85, 53, 85, 54, 101, 116, 102, 100,
+  101, 98, 69, 67, 86, 86, 102, 70, 85, 85, 100, 68, 84, 53, 100, 84, 86, 85, 69, 86, 84, 100, 85, 101,
+  54, 85, 84, 86, 69, 52, 101, 82, 100, 68, 101, 85, 86, 84, 70, 54, 85, 85, 69, 85, 54, 86, 69, 85,
+  69, 70, 100, 84, 67, 102, 86, 86, 82, 84, 70, 85, 70, 85, 100, 69, 70, 53, 84, 99, 101, 69, 86, 84,
+  68, 85, 86, 86, 98, 70, 70, 86, 68, 83, 70, 69, 84, 102, 68, 100, 53, 101, 69, 85, 69, 86, 83, 70,
+  52, 102, 69, 84, 69, 83, 68, 54, 85, 70, 102, 69, 86, 69, 67, 69, 84, 69, 83, 68, 86, 101, 54, 99,
+  68, 70, 84, 68, 101, 101, 84, 101, 52, 84, 54, 85, 69, 117, 68, 69, 69, 70, 101, 67, 101, 70, 86, 84,
+  84, 68, 102, 101, 84, 68, 85, 54, 84, 100, 101, 101, 85, 69, 99, 52, 85, 101, 85, 100, 67, 101, 69, 85,
+  70, 84, 69, 86, 101, 86, 69, 84, 70, 86, 101, 86, 85, 69, 85, 99, 84, 67, 102, 83, 85, 53, 101, 69,
+  101, 68, 70, 70, 100, 102, 84, 100, 37, 85, 68, 101, 68, 84, 53, 84, 86, 100, 85, 69, 101, 86, 85, 69,
+  100, 54, 85, 84, 83, 83, 101, 68, 69, 68, 102, 84, 100, 84, 101, 100, 70, 70, 70, 85, 84, 101, 83, 101,
+  69, 102, 69, 99, 100, 85, 85, 69, 85, 102, 101, 53, 100, 84, 85, 86, 54, 69, 69, 85, 84, 84, 69, 86,
+  70, 84, 100, 101, 69, 102, 99, 102, 68, 69, 85, 101, 84, 69, 69, 86, 83, 69, 37, 102, 86, 101, 101, 85,
+  85, 53, 101, 84, 86, 100, 70, 83, 85, 85, 69, 86, 70, 84, 117, 84, 86, 86, 84, 102, 84, 85, 69, 86,
+  99, 117, 85, 54, 86, 69, 84, 85, 86, 102, 102, 99, 86, 37, 86, 101, 85, 69, 85, 68, 84, 84, 101, 86,
+  53, 85, 69, 69, 84, 101, 100, 86, 68, 101, 71, 85, 69, 100, 85, 53, 84, 70, 86, 84, 69, 71, 101, 85,
+  86, 53, 85, 101, 68, 85, 69, 69, 85, 85, 85, 85, 85, 69, 86, 86, 84, 100, 86, 100, 69, 84, 69, 86,
+  70, 86, 52, 98, 101, 86, 69, 69, 85, 102, 101, 53, 83, 86, 85, 102, 54, 101, 67, 70, 86, 70, 85, 101,
+  86, 68, 54, 84, 69, 85, 85, 37, 101, 84, 101, 86, 69, 85, 69, 83, 101, 101, 85, 85, 100, 85, 101, 38,
+  84, 84, 68, 69, 53, 86, 53, 86, 85, 101, 69, 85, 69, 99, 101, 85, 86, 85, 100, 85, 83, 68, 85, 86,
+  84, 54, 86, 69, 100, 85, 53, 85, 70, 101, 84, 102, 69, 53, 100, 83, 69, 84, 53, 100, 100, 102, 84, 70,
+  102, 82, 102, 69, 86, 85, 85, 69, 83, 69, 85, 85, 84, 70, 68, 82, 101, 101, 101, 54, 85, 101, 85, 85,
+  102, 69, 84, 53, 85, 69, 86, 97, 85, 85, 86, 69, 85, 82, 86, 70, 101, 84, 68, 70, 84, 84, 70, 100,
+  68, 85, 86, 102, 68, 100, 101, 86, 68, 53, 86, 101, 85, 85, 69, 102, 53, 85, 98, 85, 84, 86, 85, 84,
+  99, 101, 99, 84, 69, 85, 38, 102, 85, 85, 101, 86, 53, 86, 85, 101, 83, 70, 84, 85, 70, 85, 69, 85,
+  69, 68, 85, 101, 54, 68, 83, 100, 100, 70, 100, 69, 102, 101, 68, 53, 102, 86, 69, 68, 85, 86, 101, 68,
+  68, 100, 69, 85, 99, 86, 85, 70, 101, 85, 70, 85, 86, 70, 100, 68, 86, 86, 84, 100, 68, 102, 69, 85,
+  101, 68, 69, 100, 85, 84, 102, 68, 84, 83, 101, 69, 100, 68, 85, 69, 70, 101, 102, 85, 52, 70, 85, 85,
+  54, 101, 102, 85, 85, 54, 70, 69, 99, 69, 86, 86, 101, 69, 70, 100, 84, 85, 86, 85, 69, 100, 85, 84,
+  85, 83, 101, 85, 117, 52, 85, 101, 86, 69, 85, 86, 67, 86, 101, 102, 53, 116, 84, 85, 53, 53, 102, 84,
+  86, 86, 68, 84, 84, 102, 53, 85, 85, 102, 116, 70, 86, 69, 84, 84, 53, 85, 100, 84, 100, 101, 69, 117,
+  68, 86, 86, 86, 70, 99, 84, 85, 69, 70, 86, 69, 100, 85, 69, 85, 53, 86, 85, 102, 84, 101, 84, 85,
+  69, 101, 69, 70, 99, 85, 100, 70, 116, 100, 70, 85, 70, 69, 86, 69, 101, 68, 100, 83, 86, 69, 85, 86,
+  84, 85, 99, 68, 85, 69, 38, 101, 101, 101, 101, 85, 85, 101, 68, 86, 82, 102, 85, 70, 100, 85, 69, 100,
+  101, 54, 100, 52, 102, 85, 69, 99, 84, 101, 70, 69, 84, 69, 70, 99, 101, 85, 85, 85, 69, 100, 84, 84,
+  83, 84, 101, 84, 70, 100, 85, 86, 67, 70, 100, 86, 54, 84, 85, 69, 101, 69, 86, 53, 100, 69, 102, 101,
+  68, 86, 101, 84, 84, 53, 85, 69, 70, 101, 102, 83, 70, 85, 86, 101, 68, 70, 85, 84, 98, 68, 85, 102,
+  101, 84, 83, 85, 85, 85, 67, 102, 101, 86, 69, 100, 52, 102, 84, 67, 85, 54, 70, 84, 86, 85, 101, 68,
+  69, 69, 69, 54, 101, 101, 100, 100, 86, 86, 69, 70, 101, 101, 53, 84, 68, 102, 53, 85, 85, 85, 100, 86,
+  69, 69, 70, 86, 117, 83, 83, 85, 102, 85, 86, 85, 68, 101, 101, 68, 69, 85, 101, 101, 52, 70, 100, 101,
+  100, 102, 37, 85, 68, 102, 68, 85, 86, 84, 84, 85, 84, 69, 101, 100, 86, 100, 85, 70, 84, 101, 70, 84
+};
+
+const uint8_t ORIENTATION_DISTANCES[(NUMBER_ORIENTATION_CODES + 1) / 2] PROGMEM = {
+  96, 85, 101, 85, 69, 84, 68, 68, 84, 84, 68, 68, 84, 84, 67, 67, 84, 68, 67, 69, 85, 85, 86, 68,
+  85, 85, 84, 69, 84, 51, 83, 100, 66, 84, 82, 69, 84, 84, 86, 84, 70, 84, 52, 68, 84, 52, 69, 68,
+  83, 85, 84, 68, 69, 85, 52, 69, 69, 85, 85, 69, 53, 69, 85, 85, 85, 69, 69, 86, 53, 69, 84, 68,
+  68, 67, 53, 84, 85, 84, 69, 85, 102, 84, 67, 68, 84, 84, 85, 84, 68, 69, 84, 51, 69, 68, 101, 81,
+  85, 66, 84, 84, 67, 85, 52, 68, 68, 52, 69, 84, 83, 84, 85, 68, 69, 84, 84, 67, 84, 85, 68, 69,
+  85, 84, 68, 67, 83, 83, 68, 70, 85, 101, 101, 82, 68, 82, 84, 67, 53, 84, 66, 85, 85, 69, 68, 101,
+  83, 84, 53, 84, 85, 84, 85, 84, 85, 83, 68, 85, 52, 68, 84, 83, 67, 84, 68, 53, 69, 85, 85, 84,
+  68, 85, 84, 84, 68, 85, 52, 84, 69, 68, 85, 84, 86, 70, 85, 70, 85, 85, 52, 68, 68, 84, 69, 53,
+  69, 86, 69, 69, 85, 85, 86, 86, 68, 85, 85, 68, 69, 85, 67, 101, 84, 69, 85, 70, 83, 52, 69, 69,
+  68, 84, 36, 99, 68, 85, 69, 69, 69, 83, 69, 83, 84, 84, 85, 52, 68, 86, 70, 85, 85, 101, 84, 85,
+  69, 84, 85, 69, 84, 68, 67, 83, 69, 85, 84, 84, 100, 84, 85, 83, 85, 85, 69, 85, 69, 85, 69, 70,
+  84, 70, 101, 69, 69, 86, 83, 36, 69, 83, 68, 84, 51, 85, 85, 69, 85, 86, 84, 100, 66, 85, 65, 85,
+  84, 68, 52, 84, 68, 83, 84, 67, 84, 84, 68, 85, 35, 83, 68, 69, 84, 85, 70, 85, 85, 85, 52, 68,
+  36, 86, 68, 83, 69, 84, 84, 83, 84, 84, 68, 85, 84, 83, 85, 68, 85, 85, 69, 84, 86, 85, 85, 85,
+  68, 51, 84, 84, 66, 83, 86, 85, 68, 85, 85, 69, 69, 84, 84, 85, 68, 85, 69, 68, 84, 84, 83, 68,
+  102, 101, 69, 84, 5
+};
+
+/*****************************************************************************************************
+ * Solver moves R, R', R2, U, U', U2, F, F', F2 in the canonical frame:
+ * position i receives the cubie from position MOVE_POSITIONS[m][i] and adds MOVE_ORIENTATIONS[m][i]
+ *****************************************************************************************************/
+
+const uint8_t MOVE_POSITIONS[NUMBER_SOLVER_MOVES][7] PROGMEM = {
+  0, 5, 1, 3, 4, 6, 2,
+  0, 2, 6, 3, 4, 1, 5,
+  0, 6, 5, 3, 4, 2, 1,
+  1, 2, 3, 0, 4, 5, 6,
+  3, 0, 1, 2, 4, 5, 6,
+  2, 3, 0, 1, 4, 5, 6,
+  4, 0, 2, 3, 5, 1, 6,
+  1, 5, 2, 3, 0, 4, 6,
+  5, 4, 2, 3, 1, 0, 6
+};
+const uint8_t MOVE_ORIENTATIONS[NUMBER_SOLVER_MOVES][7] PROGMEM = {
+  0, 2, 1, 0, 0, 1, 2,
+  0, 2, 1, 0, 0, 1, 2,
+  0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0,
+  2, 1, 0, 0, 1, 2, 0,
+  2, 1, 0, 0, 1, 2, 0,
+  0, 0, 0, 0, 0, 0, 0
+};
+
+/*****************************************************************************************************
+ * Frames (frame = 3 * position of cubie 7 + its orientation):
+ * - Canonical position i receives the cubie from position FRAME_POSITIONS[f][i] and adds FRAME_ORIENTATIONS[f][i]
+ * - FRAME_FACES[f][j]: Face turned instead of R, U, F (j = 0, 1, 2) in the canonical frame
+ *****************************************************************************************************/
+
+const uint8_t FRAME_POSITIONS[NUMBER_FRAMES][8] PROGMEM = {
+  7, 6, 5, 4, 3, 2, 1, 0,
+  2, 6, 7, 3, 1, 5, 4, 0,
+  5, 6, 2, 1, 4, 7, 3, 0,
+  4, 7, 6, 5, 0, 3, 2, 1,
+  3, 7, 4, 0, 2, 6, 5, 1,
+  6, 7, 3, 2, 5, 4, 0, 1,
+  5, 4, 7, 6, 1, 0, 3, 2,
+  0, 4, 5, 1, 3, 7, 6, 2,
+  7, 4, 0, 3, 6, 5, 1, 2,
+  6, 5, 4, 7, 2, 1, 0, 3,
+  1, 5, 6, 2, 0, 4, 7, 3,
+  4, 5, 1, 0, 7, 6, 2, 3,
+  1, 2, 3, 0, 5, 6, 7, 4,
+  6, 2, 1, 5, 7, 3, 0, 4,
+  3, 2, 6, 7, 0, 1, 5, 4,
+  2, 3, 0, 1, 6, 7, 4, 5,
+  7, 3, 2, 6, 4, 0, 1, 5,
+  0, 3, 7, 4, 1, 2, 6, 5,
+  3, 0, 1, 2, 7, 4, 5, 6,
+  4, 0, 3, 7, 5, 1, 2, 6,
+  1, 0, 4, 5, 2, 3, 7, 6,
+  0, 1, 2, 3, 4, 5, 6, 7,
+  5, 1, 0, 4, 6, 2, 3, 7,
+  2, 1, 5, 6, 3, 0, 4, 7
+};
+const uint8_t FRAME_ORIENTATIONS[NUMBER_FRAMES][8] PROGMEM = {
+  0, 0, 0, 0, 0, 0, 0, 0,
+  2, 1, 2, 1, 1, 2, 1, 2,
+  1, 2, 1, 2, 2, 1, 2, 1,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  2, 1, 2, 1, 1, 2, 1, 2,
+  1, 2, 1, 2, 2, 1, 2, 1,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  2, 1, 2, 1, 1, 2, 1, 2,
+  1, 2, 1, 2, 2, 1, 2, 1,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  2, 1, 2, 1, 1, 2, 1, 2,
+  1, 2, 1, 2, 2, 1, 2, 1,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  2, 1, 2, 1, 1, 2, 1, 2,
+  1, 2, 1, 2, 2, 1, 2, 1,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  2, 1, 2, 1, 1, 2, 1, 2,
+  1, 2, 1, 2, 2, 1, 2, 1,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  2, 1, 2, 1, 1, 2, 1, 2,
+  1, 2, 1, 2, 2, 1, 2, 1,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  2, 1, 2, 1, 1, 2, 1, 2,
+  1, 2, 1, 2, 2, 1, 2, 1
+};
+const uint8_t FRAME_FACES[NUMBER_FRAMES][3] PROGMEM = {
+  4, 1, 3, 1, 3, 4, 3, 4, 1, 3, 1, 5,
+  1, 5, 3, 5, 3, 1, 5, 1, 2, 1, 2, 5,
+  2, 5, 1, 2, 1, 4, 1, 4, 2, 4, 2, 1,
+  3, 0, 4, 0, 4, 3, 4, 3, 0, 5, 0, 3,
+  0, 3, 5, 3, 5, 0, 2, 0, 5, 0, 5, 2,
+  5, 2, 0, 4, 0, 2, 0, 2, 4, 2, 4, 0
+};
+
+/*****************************************************************************************************
+ * Servo commands in 'SpiCor' mode (see PocketCube.py):
+ * - Orientations: +x, -x, +y, -y, +z, -z (location of the front, right, and up face)
+ * - ORIENTATION_FACES[o]: Face at orientation o
+ * - NEXT_ORIENTATIONS[o][r]: Orientation after rotation r
+ * - SERVO_COMMANDS[r]: Servo commands of rotation r
+ *****************************************************************************************************/
+
+const uint8_t ORIENTATION_FACES[6] PROGMEM = {
+  2, 3, 4, 5, 0, 1
+};
+const uint8_t NEXT_ORIENTATIONS[6][NUMBER_ROTATIONS] PROGMEM = {
+  2, 3, 1, 0, 0, 0, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0,
+  3, 2, 0, 1, 1, 1, 4, 4, 4, 4, 4, 4, 1, 1, 1, 1, 1, 1,
+  1, 0, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 5, 4, 4, 4,
+  0, 1, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 5, 5, 5,
+  4, 4, 4, 4, 4, 4, 0, 0, 0, 2, 3, 1, 2, 2, 2, 3, 3, 3,
+  5, 5, 5, 5, 5, 5, 1, 1, 1, 3, 2, 0, 3, 3, 3, 2, 2, 2
+};
+const char SERVO_COMMANDS[NUMBER_ROTATIONS][SERVO_COMMAND_LENGTH] PROGMEM = {
+  "R",
+  "L",
+  "RR",
+  "R",
+  "L",
+  "RR",
+  "TR",
+  "TL",
+  "TRR",
+  "TTTR",
+  "TTTL",
+  "TTTRR",
+  "TRTTLTR",
+  "TRTTLTL",
+  "TRTTLTRR",
+  "TLTTRTR",
+  "TLTTRTL",
+  "TLTTRTRR"
+};
+
+#endif
@@ -0,0 +1,67 @@
+/*****************************************************************************************************
+ * Ring buffer of timed events for latency breakdowns of solves.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/cubes
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#include <Arduino.h>
+#include "Trace.h"
+
+/*****************************************************************************************************
+ * Methods
+ *****************************************************************************************************/
+
+/**! Store event in the ring buffer (overwrites and counts the oldest event when the buffer is full).
+ * 
+ * @param id [in] Event identifier
+ * @param startUs [in] Start time [us]
+ * @param endUs [in] End time [us]
+ */
+void Trace::record(char id, unsigned long startUs, unsigned long endUs) {
+#if TRACE_ENABLED
+  events[nextIndex].id = id;
+  events[nextIndex].startUs = startUs;
+  events[nextIndex].endUs = endUs;
+  nextIndex = (nextIndex + 1) % TRACE_BUFFER_SIZE;
+  if (count < TRACE_BUFFER_SIZE) {
+    count++;
+  } else {
+    dropped++;
+  }
+#endif
+}
+
+/**! Send current time and all events (oldest first) via serial interface and clear the buffer.
+ * 
+ * Format: "now <us>", then one line "trace <id> <start us> <end us>" per event, then "dropped <number>"
+ * (events overwritten since the last dump), then "end".
+ * The current time is sent first, so that the Python script can align the clocks.
+ */
+void Trace::dump(void) {
+  Serial.print("now ");
+  Serial.println(micros());
+
+#if TRACE_ENABLED
+  int index = (nextIndex - count + TRACE_BUFFER_SIZE) % TRACE_BUFFER_SIZE;
+  for (int i = 0; i < count; i++) {
+    Serial.print("trace ");
+    Serial.print(events[index].id);
+    Serial.print(' ');
+    Serial.print(events[index].startUs);
+    Serial.print(' ');
+    Serial.println(events[index].endUs);
+    index = (index + 1) % TRACE_BUFFER_SIZE;
+  }
+  Serial.print("dropped ");
+  Serial.println(dropped);
+  nextIndex = 0;
+  count = 0;
+  dropped = 0;
+#endif
+
+  Serial.println("end");
+}
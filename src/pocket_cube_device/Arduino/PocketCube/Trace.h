@@ -0,0 +1,53 @@
+/*****************************************************************************************************
+ * Ring buffer of timed events for latency breakdowns of solves.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/cubes
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************
+ * Events are identified by a character:
+ * - '<': Receiving a command string via the serial interface (starts when the main loop polls
+ *        the interface, i.e., the time since the host sent the string is queueing latency)
+ * - 'I', 'L', 'R', 'T', '>': Execution of the corresponding command
+ * - 'P': Solving a packed state on the device (without executing the servo program)
+ *
+ * The Python script requests the events by sending '?' (see SolveTrace.py). If more events occur
+ * than fit into the buffer between two requests, the oldest events are overwritten and counted as
+ * dropped, so that incomplete traces are reported to the host.
+ * Recording is enabled by TRACE_ENABLED in Config.h.
+ *****************************************************************************************************/
+
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+#include "Config.h"
+
+class Trace {
+
+  /*****************************************************************************************************
+   * Attributes
+   *****************************************************************************************************/
+  private:
+#if TRACE_ENABLED
+    struct Event {
+      char id;                      // Event identifier (see above)
+      unsigned long startUs;        // Start time [us] (micros())
+      unsigned long endUs;          // End time [us] (micros())
+    };
+    Event events[TRACE_BUFFER_SIZE];
+    int nextIndex = 0;              // Index to store next event at
+    int count = 0;                  // Number of valid events in buffer
+    unsigned int dropped = 0;       // Number of events overwritten since the last dump
+#endif
+
+  /*****************************************************************************************************
+   * Methods
+   *****************************************************************************************************/
+  public:
+    void record(char id, unsigned long startUs, unsigned long endUs);
+    void dump(void);
+};
+
+#endif
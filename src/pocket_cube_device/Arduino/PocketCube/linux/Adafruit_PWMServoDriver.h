@@ -0,0 +1,29 @@
+/*****************************************************************************************************
+ * Stand-in of the PCA9685 servo board to run the firmware on Linux (see Arduino.h).
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/cubes
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#ifndef _ADAFRUIT_PWM_SERVO_DRIVER_H_
+#define _ADAFRUIT_PWM_SERVO_DRIVER_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <Arduino.h>
+
+class Adafruit_PWMServoDriver {
+  public:
+    void begin(void) {}
+    void setPWMFreq(float /* frequencyHz */) {}
+
+    /* Log the PWM setting (time [ms], channel, ticks) to the standard error */
+    void setPWM(uint8_t channel, uint16_t /* on */, uint16_t off) {
+      fprintf(stderr, "%10lu ms: pwm %u %u\n", millis(), channel, off);
+    }
+};
+
+#endif
@@ -0,0 +1,66 @@
+/*****************************************************************************************************
+ * Stand-in of the Arduino core to build and run the firmware on Linux.
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/cubes
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************
+ * The Arduino IDE does not compile the folder 'linux'. Build and run on Linux (in the sketch folder):
+ * 
+ *   g++ -std=c++11 -O2 -Wall -Wextra -I linux -include Arduino.h -x c++ PocketCube.ino -x none \
+ *       Servos.cpp SerialCom.cpp Trace.cpp Solver.cpp Planner.cpp linux/Linux.cpp -o PocketCube
+ *   echo "P88C6FA0000>" | ./PocketCube
+ * 
+ * - Serial: Each line of the standard input is one string sent by the host. Output goes to the
+ *   standard output.
+ * - Servo board: PWM settings are logged to the standard error.
+ * - delay() does not wait, but advances the time returned by micros() and millis().
+ *****************************************************************************************************/
+
+#ifndef _ARDUINO_H_
+#define _ARDUINO_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*****************************************************************************************************
+ * Flash memory (program memory is ordinary memory)
+ *****************************************************************************************************/
+
+#define PROGMEM
+#define pgm_read_byte(address) (*(const uint8_t*)(address))
+#define strcpy_P(destination, source) strcpy((destination), (source))
+
+/*****************************************************************************************************
+ * Time
+ *****************************************************************************************************/
+
+unsigned long micros(void);
+unsigned long millis(void);
+void delay(unsigned long ms);
+
+/*****************************************************************************************************
+ * Serial interface
+ *****************************************************************************************************/
+
+class SerialStandIn {
+  public:
+    void begin(unsigned long baudRate);
+    int available(void);
+    int read(void);
+    bool isClosed(void);
+    void print(const char *text);
+    void print(char c);
+    void print(int value);
+    void print(unsigned long value);
+    void println(void);
+    void println(const char *text);
+    void println(unsigned long value);
+};
+
+extern SerialStandIn Serial;
+
+#endif
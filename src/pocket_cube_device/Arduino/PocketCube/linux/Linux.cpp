@@ -0,0 +1,86 @@
+/*****************************************************************************************************
+ * Stand-ins of the Arduino core and main program to run the firmware on Linux (see Arduino.h).
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/cubes
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#include <stdio.h>
+#include <chrono>
+#include <string>
+#include <iostream>
+#include "Arduino.h"
+
+/*****************************************************************************************************
+ * Time (real time plus the time of all delays)
+ *****************************************************************************************************/
+
+static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+static unsigned long delayedUs = 0;
+
+unsigned long micros(void) {
+  auto elapsed = std::chrono::steady_clock::now() - startTime;
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() + delayedUs;
+}
+
+unsigned long millis(void) {
+  return micros() / 1000;
+}
+
+void delay(unsigned long ms) {
+  delayedUs += 1000 * ms;
+}
+
+/*****************************************************************************************************
+ * Serial interface (one line of the standard input per received string)
+ *****************************************************************************************************/
+
+SerialStandIn Serial;
+static std::string receiveBuffer;
+static size_t receiveIndex = 0;
+static bool isInputClosed = false;
+
+void SerialStandIn::begin(unsigned long /* baudRate */) {}
+
+int SerialStandIn::available(void) {
+  return (int)(receiveBuffer.size() - receiveIndex);
+}
+
+int SerialStandIn::read(void) {
+  return (receiveIndex < receiveBuffer.size()) ? receiveBuffer[receiveIndex++] : -1;
+}
+
+bool SerialStandIn::isClosed(void) {
+  // Next line is received when all characters have been read
+  if ((available() == 0) && !isInputClosed) {
+    isInputClosed = !std::getline(std::cin, receiveBuffer);
+    receiveIndex = 0;
+  }
+  return isInputClosed && (available() == 0);
+}
+
+void SerialStandIn::print(const char *text) { fputs(text, stdout); }
+void SerialStandIn::print(char c) { fputc(c, stdout); }
+void SerialStandIn::print(int value) { printf("%d", value); }
+void SerialStandIn::print(unsigned long value) { printf("%lu", value); }
+void SerialStandIn::println(void) { fputc('\n', stdout); fflush(stdout); }
+void SerialStandIn::println(const char *text) { print(text); println(); }
+void SerialStandIn::println(unsigned long value) { print(value); println(); }
+
+/*****************************************************************************************************
+ * Main program
+ *****************************************************************************************************/
+
+void setup(void);
+void loop(void);
+
+int main(void) {
+  setup();
+  while (!Serial.isClosed()) {
+    loop();
+  }
+  return 0;
+}
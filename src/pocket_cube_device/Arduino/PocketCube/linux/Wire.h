@@ -0,0 +1,14 @@
+/*****************************************************************************************************
+ * Stand-in of the I2C library to build the firmware on Linux (see Arduino.h).
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/cubes
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************/
+
+#ifndef _WIRE_H_
+#define _WIRE_H_
+
+#endif
@@ -5,12 +5,13 @@ Communcation with Arduino board using USB.
 @contact: http://www.haw-hamburg.de/marc-hensel
 
 @copyright: 2023, Marc Hensel
-@version: 2023.07.28
+@version: 2026.10.18
 @license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
 """
 
 import sys
 import serial, time
+from SolveTrace import SolveTrace
 
 class ArduinoCOM():
 
@@ -18,7 +19,7 @@ class ArduinoCOM():
     # Constructor
     # ----------------------------------------------------------------------
 
-    def __init__(self, serialCOM = None, baudRate = 9600, readTimeoutSec = 60.0, terminateOnFailure=True):
+    def __init__(self, serialCOM = None, baudRate = 9600, readTimeoutSec = 60.0, terminateOnFailure=True, trace=None):
         """
         Constructor.
 
@@ -33,6 +34,8 @@ class ArduinoCOM():
             Maximum time in [s] to wait when reading data from Arduino. (Default: 60.0)
         terminateOnFailure : bool, optional
             Shall script terminate when no connection is possible? (Default: True)
+        trace : SolveTrace, optional
+            Records serial transfers. Tracing is disabled, if None. (Default: None)
 
         Returns
         -------
@@ -40,6 +43,8 @@ class ArduinoCOM():
 
         """
         self._serial = None
+        self.baudRate = baudRate
+        self.trace = trace if trace is not None else SolveTrace(enabled=False)
         
         # Try to connect to specific COM port
         if serialCOM != None:
@@ -121,7 +126,8 @@ class ArduinoCOM():
 
         """
         if self._serial != None:
-            data = self._serial.readline()
+            with self.trace.span('serial read', 'serial'):
+                data = self._serial.readline()
             if data:
                 return str(data, 'utf-8').rstrip('\n')
         return None
@@ -143,11 +149,33 @@ class ArduinoCOM():
         """
         if self._serial != None:
             print("Send: " + data)
-            self._serial.write(data.encode('utf-8'))
-            self._serial.flush()
+            with self.trace.span('serial write', 'serial', data=data):
+                self._serial.write(data.encode('utf-8'))
+                self._serial.flush()
             return True
         else:
             return False
+
+    # ----------------------------------------------------------------------
+
+    def transferTimeUs(self, numberChars):
+        """
+        Get the time to transfer characters at the connection's baud rate.
+
+        Each character is sent as 10 bits (start bit, 8 data bits, stop bit).
+
+        Parameters
+        ----------
+        numberChars : int
+            Number of characters.
+
+        Returns
+        -------
+        float
+            Transfer time [us].
+
+        """
+        return numberChars * 10 * 1e6 / self.baudRate
     
 # ========== Main (sample movements of Pocket cube solver) ==========
 
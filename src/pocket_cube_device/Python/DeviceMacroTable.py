@@ -0,0 +1,360 @@
+"""
+Table of the fastest servo programs solving a Pocket cube on the device.
+
+The device turns the cube by two servos (see PocketCube.ino):
+- 'R', 'L': Rotate the lower layer by 90° (action D or d of the cube as seen
+  by the device). The rotation servo moves in [0°, 270°], so that 'R' at 270°
+  and 'L' at 0° rotate by 270° back to the other end (3 times the time).
+- 'T': Turn the cube vertically (front face to bottom, i.e., actions r and L).
+
+The physical state of the device is the cube as seen by the device and the
+angle of the rotation servo, stored as the code of the cube, its frame (refer
+to class StateCode), and the angle. The tables are not reduced by symmetry:
+the device distinguishes all 24 orientations of the cube, and the mirror
+symmetry of the device is not exploited. Hence, the tables have one entry per
+physical state, i.e., 3,674,160 * 24 * 4 = 352,719,360 entries indexed by
+
+    index = 4 * (24 * code + frame) + angle / 90°
+
+An offline generator searches backward from the solved cube in any
+orientation and angle (Dial's algorithm, i.e., Dijkstra with buckets of
+equal time) using the servo delays of Config.h. It stores
+- the remaining time [ms] of the fastest program (uint16, 705 MB) and
+- the next servo command 'T', 'R', or 'L' (2 bits, 88 MB).
+
+The runtime plans a whole program by walking the command table, which takes
+microseconds per command. Commands are grouped into macros (turns followed
+by rotations in one direction, e.g., 'TTR' or 'LL').
+
+@author: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+
+@copyright: 2026, Marc Hensel
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add Pocket cube env to path
+import os
+import sys
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'pocket_cube_gym'))
+
+# Other imports
+import time
+import numpy as np
+from PCubeAction import Action
+from PCubeCode import StateCode
+
+class DeviceMacroTable():
+
+    # ----------------------------------------------------------------------
+    # Class constants
+    # ----------------------------------------------------------------------
+
+    # Servo delays (see Config.h)
+    TURN_DELAY_MS = 550             # Each direction (forward, backward)
+    ROTATE_DELAY_MS = 650           # Each 90° step
+
+    # Servo commands (values stored in the command table)
+    COMMANDS = ('T', 'R', 'L')
+    _turn, _right, _left = range(3)
+
+    # Table dimensions
+    NUMBER_FRAMES = 24
+    NUMBER_ANGLES = 4
+    NUMBER_STATES = StateCode.NUMBER_CODES * NUMBER_FRAMES * NUMBER_ANGLES
+
+    # Default directory and file names of the tables
+    DEFAULT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'tables')
+    TIME_FILE = 'PCube_DeviceTime.npy'
+    COMMAND_FILE = 'PCube_DeviceCommand.npy'
+
+    # ----------------------------------------------------------------------
+    # Constructor
+    # ----------------------------------------------------------------------
+
+    def __init__(self, tableDir=None, verbose=True):
+        """
+        Constructor, loads the tables (generated and saved, if not existing).
+
+        Parameters
+        ----------
+        tableDir : string, optional
+            Directory of the tables. (Default: None, i.e., DeviceMacroTable.DEFAULT_DIR)
+        verbose : bool, optional
+            Print progress of the generation. (Default: True)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.tableDir = DeviceMacroTable.DEFAULT_DIR if tableDir is None else tableDir
+        timeFile = os.path.join(self.tableDir, DeviceMacroTable.TIME_FILE)
+        commandFile = os.path.join(self.tableDir, DeviceMacroTable.COMMAND_FILE)
+        if not (os.path.exists(timeFile) and os.path.exists(commandFile)):
+            os.makedirs(self.tableDir, exist_ok=True)
+            times, commands = DeviceMacroTable.generate(verbose=verbose)
+            for fileName, table in ((timeFile, times), (commandFile, commands)):
+                tempName = f'{fileName}.{os.getpid()}.tmp'
+                with open(tempName, 'wb') as file:
+                    np.save(file, table)
+                os.replace(tempName, fileName)
+            times = commands = None
+
+        # Memory-mapped (shared between processes, pages loaded on access)
+        self.times = np.load(timeFile, mmap_mode='r')
+        self.commands = np.load(commandFile, mmap_mode='r')
+
+    # ----------------------------------------------------------------------
+    # Device model
+    # ----------------------------------------------------------------------
+
+    def _cubeMoves():
+        """
+        Get the actions (as seen by the device) of the rotation and the turn.
+
+        Returns
+        -------
+        tuple(Action, Action, list(Action))
+            Action of 'R', action of 'L', and actions of 'T'.
+
+        """
+        return Action.D, Action.d, [Action.r, Action.L]
+
+    # ----------------------------------------------------------------------
+
+    def commandTimeMs(command, angle):
+        """
+        Get the time of a servo command at a rotation servo angle.
+
+        Parameters
+        ----------
+        command : int
+            Command value (index in DeviceMacroTable.COMMANDS).
+        angle : int
+            Rotation servo angle / 90° in [0, 3].
+
+        Returns
+        -------
+        tuple(int, int)
+            Time [ms] and rotation servo angle / 90° after the command.
+
+        """
+        if command == DeviceMacroTable._turn:
+            return 2 * DeviceMacroTable.TURN_DELAY_MS, angle
+        step = 1 if command == DeviceMacroTable._right else -1
+        steps = 3 if (angle + step) % 4 != angle + step else 1
+        return steps * DeviceMacroTable.ROTATE_DELAY_MS, (angle + step) % 4
+
+    # ----------------------------------------------------------------------
+
+    def _turnFrames():
+        """
+        Get the frame after turning the cube for each frame (the code does not change).
+        """
+        _, _, turnActions = DeviceMacroTable._cubeMoves()
+        frames = np.arange(DeviceMacroTable.NUMBER_FRAMES)
+        for action in turnActions:
+            frames = StateCode.NEXT_FRAMES[frames, action.value]
+        return frames
+
+    # ----------------------------------------------------------------------
+    # Generate tables
+    # ----------------------------------------------------------------------
+
+    def generate(verbose=True):
+        """
+        Search the fastest programs backward from the solved cube.
+
+        Parameters
+        ----------
+        verbose : bool, optional
+            Print progress. (Default: True)
+
+        Returns
+        -------
+        tuple(numpy.ndarray, numpy.ndarray)
+            Remaining time [ms] of each index (uint16) and next command of
+            each index (2 bits, four indices per byte).
+
+        """
+        startTime = time.perf_counter()
+        actionR, actionL, _ = DeviceMacroTable._cubeMoves()
+        inverseTurnFrames = np.argsort(DeviceMacroTable._turnFrames())
+        turnMs = 2 * DeviceMacroTable.TURN_DELAY_MS
+        rotateMs = DeviceMacroTable.ROTATE_DELAY_MS
+
+        # Solved cube in any frame and angle
+        times = np.full(DeviceMacroTable.NUMBER_STATES, np.iinfo(np.uint16).max, dtype=np.uint16)
+        commands = np.zeros(DeviceMacroTable.NUMBER_STATES, dtype=np.uint8)
+        solved = np.arange(DeviceMacroTable.NUMBER_FRAMES * DeviceMacroTable.NUMBER_ANGLES, dtype=np.int64)
+        times[solved] = 0
+        buckets = {0: [solved]}
+
+        # Expand states in order of increasing time (predecessors by the inverse commands)
+        numberFinal = 0
+        while len(buckets) > 0:
+            timeMs = min(buckets)
+            indices = np.concatenate(buckets.pop(timeMs))
+            indices = np.unique(indices[times[indices] == timeMs])
+            numberFinal += len(indices)
+            codeFrames, angles = np.divmod(indices, DeviceMacroTable.NUMBER_ANGLES)
+            codes, frames = np.divmod(codeFrames, DeviceMacroTable.NUMBER_FRAMES)
+            codeFrames = indices = None
+
+            # 'T' turned the cube of the predecessor (same code)
+            predecessors = [(DeviceMacroTable._turn, codes, inverseTurnFrames[frames], angles, turnMs)]
+
+            # 'R' and 'L' rotated the predecessor's lower layer (inverse action) and moved the servo
+            for command, inverseAction, step in ((DeviceMacroTable._right, actionL, -1), (DeviceMacroTable._left, actionR, 1)):
+                priorAngles = (angles + step) % 4
+                isWrapped = priorAngles - step != angles
+                predecessors.append((command, StateCode.next_codes(codes, StateCode.FRAME_ACTIONS[frames, inverseAction.value]),
+                                     StateCode.NEXT_FRAMES[frames, inverseAction.value], priorAngles,
+                                     np.where(isWrapped, 3 * rotateMs, rotateMs)))
+
+            for command, priorCodes, priorFrames, priorAngles, commandMs in predecessors:
+                priorIndices = (priorCodes.astype(np.int64) * DeviceMacroTable.NUMBER_FRAMES + priorFrames) * DeviceMacroTable.NUMBER_ANGLES + priorAngles
+                priorTimes = timeMs + commandMs
+                isFaster = priorTimes < times[priorIndices]
+                priorIndices = priorIndices[isFaster]
+                priorTimes = np.broadcast_to(priorTimes, isFaster.shape)[isFaster]
+                times[priorIndices] = priorTimes
+                commands[priorIndices] = command
+                for t in np.unique(priorTimes).tolist():
+                    buckets.setdefault(t, []).append(priorIndices[priorTimes == t])
+
+            if verbose:
+                print(f'{timeMs:6} ms: {numberFinal:>12_} of {DeviceMacroTable.NUMBER_STATES:_} states '
+                      f'({time.perf_counter() - startTime:.0f} s)', flush=True)
+
+        # Pack commands (2 bits each)
+        commands = commands.reshape(-1, 4)
+        packed = (commands[:, 0] | (commands[:, 1] << 2) | (commands[:, 2] << 4) | (commands[:, 3] << 6)).astype(np.uint8)
+        return times, packed
+
+    # ----------------------------------------------------------------------
+    # Getter
+    # ----------------------------------------------------------------------
+
+    def _index(code, frame, angle):
+        """
+        Get the table index of a code, frame, and rotation servo angle / 90°.
+        """
+        return (code * DeviceMacroTable.NUMBER_FRAMES + frame) * DeviceMacroTable.NUMBER_ANGLES + angle
+
+    # ----------------------------------------------------------------------
+
+    def remainingTimeMs(self, state, angleDegree=0):
+        """
+        Get the time [ms] of the fastest program solving the cube.
+
+        Parameters
+        ----------
+        state : State
+            Cube as seen by the device.
+        angleDegree : int, optional
+            Rotation servo angle in [0, 90, 180, 270]. (Default: 0)
+
+        Returns
+        -------
+        int
+            Time [ms] (servo delays only).
+
+        """
+        index = DeviceMacroTable._index(StateCode.encode(state), StateCode.frame(state), angleDegree // 90)
+        return int(self.times[index])
+
+    # ----------------------------------------------------------------------
+
+    def _command(self, index):
+        """
+        Get the next command value of a table index.
+        """
+        return (int(self.commands[index >> 2]) >> ((index & 3) << 1)) & 3
+
+    # ----------------------------------------------------------------------
+    # Plan programs
+    # ----------------------------------------------------------------------
+
+    def plan(self, state, angleDegree=0):
+        """
+        Plan the fastest servo program solving the cube by walking the table.
+
+        Parameters
+        ----------
+        state : State
+            Cube as seen by the device.
+        angleDegree : int, optional
+            Rotation servo angle in [0, 90, 180, 270]. (Default: 0)
+
+        Returns
+        -------
+        tuple(list(string), int, int)
+            Macros (e.g., ['TTR', 'LL']), time [ms], and final rotation servo angle [°].
+
+        """
+        actionR, actionL, _ = DeviceMacroTable._cubeMoves()
+        turnFrames = DeviceMacroTable.__turnFrames
+        code, frame, angle = StateCode.encode(state), StateCode.frame(state), angleDegree // 90
+        macros, programMs = [], 0
+        macro, lastCommand = '', None
+
+        while code != StateCode.SOLVED_CODE:
+            command = self._command(DeviceMacroTable._index(code, frame, angle))
+            commandMs, angle = DeviceMacroTable.commandTimeMs(command, angle)
+            programMs += commandMs
+
+            # New macro on turns after rotations and on changes of the rotation direction
+            if (lastCommand is not None) and (lastCommand != DeviceMacroTable._turn) and (command != lastCommand):
+                macros.append(macro)
+                macro = ''
+            macro += DeviceMacroTable.COMMANDS[command]
+            lastCommand = command
+
+            # Apply command to the cube
+            if command == DeviceMacroTable._turn:
+                frame = int(turnFrames[frame])
+            else:
+                action = actionR if command == DeviceMacroTable._right else actionL
+                code = StateCode.next_code(code, int(StateCode.FRAME_ACTIONS[frame, action.value]))
+                frame = int(StateCode.NEXT_FRAMES[frame, action.value])
+
+        if len(macro) > 0:
+            macros.append(macro)
+        return macros, programMs, 90 * angle
+
+    # ----------------------------------------------------------------------
+
+    def program(self, state, angleDegree=0):
+        """
+        Get the fastest servo program as string sent to the device (e.g., 'TTRLL>').
+        """
+        macros, _, _ = self.plan(state, angleDegree)
+        return ''.join(macros) + '>'
+
+# ========== Class-level tables (require the class to be defined) ==========
+
+DeviceMacroTable._DeviceMacroTable__turnFrames = DeviceMacroTable._turnFrames()
+
+# ========== Main (sample device programs) ==========
+
+if __name__ == '__main__':
+    import random
+    from PCubeState import State
+
+    table = DeviceMacroTable()
+    print(f'Tables: {(table.times.nbytes + table.commands.nbytes) / 2**20:.0f} MiB')
+
+    # Plan programs of randomly scrambled cubes
+    for _ in range(5):
+        state = State()
+        for _ in range(20):
+            state = state.next_state(random.choice(list(Action)))
+        angleDegree = random.choice([0, 90, 180, 270])
+        startNs = time.perf_counter_ns()
+        macros, programMs, finalDegree = table.plan(state, angleDegree)
+        planUs = (time.perf_counter_ns() - startNs) / 1000.0
+        print(f'Start at {angleDegree:3}°: {programMs / 1000.0:5.1f} s (table: {table.remainingTimeMs(state, angleDegree) / 1000.0:5.1f} s), '
+              f'planned in {planUs:6.1f} us: {" ".join(macros)}')
@@ -0,0 +1,368 @@
+"""
+Shortest scan sequences and state inference from partially scanned colors.
+
+The scan sequence 'RRRRTT RRRRTT' (see PocketCube._rotation2servoCmd) shows
+all 24 stickers to the camera, but fewer determine the state:
+- Two stickers of a corner determine the cubie and its orientation.
+- The cubie of the last corner follows from the other 7 cubies and its
+  orientation from the twist rule (sum of orientations is 0 modulo 3).
+Hence, the state is known for any cube if at most one corner shows less than
+two stickers. If a second corner shows one sticker or less, there are cubes
+for which two states match the scanned colors (e.g., two corners showing
+white on top may be swapped). Which sticker of the cube the camera sees after
+a servo command does not depend on the colors, so that this condition is
+checked without knowing the cube.
+
+The planner searches the fastest servo commands (Dijkstra, servo times of
+DeviceMacroTable) until the camera has seen enough stickers. The camera
+sees one face of the cube as seen by the device (default: front) before the
+first and after each command. Note that 'R' and 'L' turn the lower layer, so
+that the cube's state after the scan is passed to the solver (see stateAfter()).
+
+@author: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+
+@copyright: 2026, Marc Hensel
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add Pocket cube env to path
+import os
+import sys
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'pocket_cube_gym'))
+
+# Other imports
+import heapq
+from PCubeState import State
+from DeviceMacroTable import DeviceMacroTable
+
+class PartialScan():
+
+    # ----------------------------------------------------------------------
+    # Class constants
+    # ----------------------------------------------------------------------
+
+    # Faces in the order of State.get_plane_representation()
+    FACES = ('U', 'L', 'B', 'F', 'R', 'D')
+
+    # Sequence scanning all stickers (see PocketCube._rotation2servoCmd)
+    FULL_SCAN = 'RRRRTTRRRRTT'
+
+    # Projection of the corners (position, sticker) on the faces and colors of the cubies
+    _cornerMaps = State._State__corner_maps
+    _cornerColors = State._State__corner_colors
+
+    # ----------------------------------------------------------------------
+    # Constructor
+    # ----------------------------------------------------------------------
+
+    def __init__(self, cameraFace='F', maxCommands=12):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        cameraFace : string, optional
+            Face of the cube (as seen by the device) facing the camera. (Default: 'F')
+        maxCommands : int, optional
+            Maximum number of servo commands of planned scans. (Default: 12)
+
+        Returns
+        -------
+        None.
+
+        """
+        self._cameraFace = PartialScan.FACES.index(cameraFace)
+        self._maxCommands = maxCommands
+
+        # Stickers (position, sticker) facing the camera, ordered by location on the face
+        stickers = [None] * 4
+        for position, mapping in enumerate(PartialScan._cornerMaps):
+            for sticker, (face, location) in enumerate(mapping):
+                if face == self._cameraFace:
+                    stickers[location] = (position, sticker)
+        self._cameraStickers = tuple(stickers)
+
+    # ----------------------------------------------------------------------
+    # Device model
+    # ----------------------------------------------------------------------
+
+    def _commandActions(command):
+        """
+        Get the actions (as seen by the device) of a servo command 'R', 'L', or 'T'.
+        """
+        actionR, actionL, turnActions = DeviceMacroTable._cubeMoves()
+        return {'R': [actionR], 'L': [actionL], 'T': turnActions}[command]
+
+    # ----------------------------------------------------------------------
+
+    def _applyCommand(tracking, command):
+        """
+        Apply a servo command to a tracking state.
+
+        The tracking state is a State starting with identity positions and
+        orientations, i.e., position p holds the corner that was at position
+        positions[p] before the scan, turned by orientations[p].
+        """
+        for action in PartialScan._commandActions(command):
+            tracking = tracking.next_state(action)
+        return tracking
+
+    # ----------------------------------------------------------------------
+
+    def _visibleStickers(self, tracking):
+        """
+        Get the stickers (position, sticker) before the scan facing the camera, ordered by location.
+        """
+        return tuple((tracking.positions[position], (sticker - tracking.orientations[position]) % 3)
+                     for position, sticker in self._cameraStickers)
+
+    # ----------------------------------------------------------------------
+
+    def seenStickers(self, commands):
+        """
+        Get the stickers seen by the camera before the first and after each servo command.
+
+        Parameters
+        ----------
+        commands : string
+            Servo commands (e.g., 'RRRRTT'; spaces are ignored).
+
+        Returns
+        -------
+        list(tuple)
+            Per view, the stickers (position, sticker) of the cube before the
+            scan in the order of the camera face's locations.
+
+        """
+        tracking = State()
+        views = [self._visibleStickers(tracking)]
+        for command in commands.replace(' ', ''):
+            tracking = PartialScan._applyCommand(tracking, command)
+            views.append(self._visibleStickers(tracking))
+        return views
+
+    # ----------------------------------------------------------------------
+
+    def isSufficient(seen):
+        """
+        Check whether scanned stickers determine the state of any cube.
+
+        Parameters
+        ----------
+        seen : iterable(tuple)
+            Stickers (position, sticker) seen.
+
+        Returns
+        -------
+        bool
+            True if at most one corner shows less than two stickers, else False.
+
+        """
+        stickersPerCorner = [0] * 8
+        for position, _ in set(seen):
+            stickersPerCorner[position] += 1
+        return sum(count < 2 for count in stickersPerCorner) <= 1
+
+    # ----------------------------------------------------------------------
+    # Plan scan sequence
+    # ----------------------------------------------------------------------
+
+    def plan(self, angleDegree=0, commands=''):
+        """
+        Find the fastest servo commands scanning sufficient stickers.
+
+        Parameters
+        ----------
+        angleDegree : int, optional
+            Rotation servo angle in [0, 90, 180, 270]. (Default: 0)
+        commands : string, optional
+            Servo commands executed so far, i.e., plan the rest of a scan. (Default: '')
+
+        Returns
+        -------
+        tuple(string, int, int)
+            Servo commands (e.g., 'RRTR'), time [ms], and final rotation servo angle [°].
+
+        """
+        tracking = State()
+        seen = set(self._visibleStickers(tracking))
+        for command in commands.replace(' ', ''):
+            tracking = PartialScan._applyCommand(tracking, command)
+            seen.update(self._visibleStickers(tracking))
+        queue = [(0, '', angleDegree // 90, tracking.positions, tracking.orientations, frozenset(seen))]
+        visited = set()
+
+        while len(queue) > 0:
+            timeMs, commands, angle, positions, orientations, seen = heapq.heappop(queue)
+            if PartialScan.isSufficient(seen):
+                return commands, timeMs, 90 * angle
+            key = (angle, positions, orientations, seen)
+            if (key in visited) or (len(commands) >= self._maxCommands):
+                continue
+            visited.add(key)
+
+            for value, command in enumerate(DeviceMacroTable.COMMANDS):
+                commandMs, nextAngle = DeviceMacroTable.commandTimeMs(value, angle)
+                nextTracking = PartialScan._applyCommand(State(positions, orientations), command)
+                nextSeen = seen.union(self._visibleStickers(nextTracking))
+                heapq.heappush(queue, (timeMs + commandMs, commands + command, nextAngle,
+                                       nextTracking.positions, nextTracking.orientations, nextSeen))
+        return None
+
+    # ----------------------------------------------------------------------
+
+    def scanTimeMs(commands, angleDegree=0):
+        """
+        Get the time [ms] of servo commands starting at a rotation servo angle.
+        """
+        timeMs, angle = 0, angleDegree // 90
+        for command in commands.replace(' ', ''):
+            commandMs, angle = DeviceMacroTable.commandTimeMs(DeviceMacroTable.COMMANDS.index(command), angle)
+            timeMs += commandMs
+        return timeMs
+
+    # ----------------------------------------------------------------------
+    # Infer state
+    # ----------------------------------------------------------------------
+
+    def decode(self, commands, views):
+        """
+        Infer the state of the cube before the scan from the colors seen by the camera.
+
+        Parameters
+        ----------
+        commands : string
+            Servo commands of the scan (spaces are ignored).
+        views : list(list(char))
+            Colors of the camera face (e.g., ['R', 'R', 'W', 'G']) before the
+            first and after each command, ordered as in State.get_plane_representation().
+
+        Raises
+        ------
+        ValueError
+            If the colors match no state or more than one state.
+
+        Returns
+        -------
+        State
+            Cube (as seen by the device) before the scan.
+
+        """
+        solutions = self.candidates(commands, views, maxCandidates=1)
+        if len(solutions) == 0:
+            raise ValueError('Colors match no state')
+        if len(solutions) > 1:
+            raise ValueError('Colors match more than one state')
+        return solutions[0]
+
+    # ----------------------------------------------------------------------
+
+    def candidates(self, commands, views, maxCandidates=None):
+        """
+        Get the states matching the colors seen so far (e.g., during the scan).
+
+        Parameters
+        ----------
+        commands : string
+            Servo commands executed so far (spaces are ignored).
+        views : list(list(char))
+            Colors of the camera face before the first and after each command.
+        maxCandidates : int, optional
+            Stop after maxCandidates + 1 states, if not None. (Default: None)
+
+        Raises
+        ------
+        ValueError
+            If the views contradict each other.
+
+        Returns
+        -------
+        list(State)
+            Cubes (as seen by the device) before the scan matching the colors.
+
+        """
+        # Colors seen per corner and sticker
+        colors = [dict() for _ in range(8)]
+        for stickers, viewColors in zip(self.seenStickers(commands), views):
+            for (position, sticker), color in zip(stickers, viewColors):
+                if colors[position].setdefault(sticker, color) != color:
+                    raise ValueError(f'Colors of corner {position} differ between views')
+
+        # Cubies and orientations matching the colors of each corner
+        candidates = []
+        for position in range(8):
+            candidates.append([(cubie, orientation) for cubie in range(8) for orientation in range(3)
+                               if all(PartialScan._cornerColors[cubie][(sticker - orientation) % 3] == color
+                                      for sticker, color in colors[position].items())])
+
+        # Assign cubies to corners (most constrained first)
+        order = sorted(range(8), key=lambda position: len(candidates[position]))
+        states = []
+        positions, orientations = [None] * 8, [None] * 8
+
+        def assign(index, usedCubies, twist):
+            if (maxCandidates is not None) and (len(states) > maxCandidates):
+                return
+            if index == 8:
+                if twist % 3 == 0:
+                    states.append(State(tuple(positions), tuple(orientations)))
+                return
+            position = order[index]
+            for cubie, orientation in candidates[position]:
+                if not usedCubies & (1 << cubie):
+                    positions[position], orientations[position] = cubie, orientation
+                    assign(index + 1, usedCubies | (1 << cubie), twist + orientation)
+
+        assign(0, 0, 0)
+        return states
+
+    # ----------------------------------------------------------------------
+
+    def views(self, state, commands):
+        """
+        Get the colors the camera sees when scanning a known cube (e.g., for simulations).
+        """
+        views = [state.get_plane_representation()[self._cameraFace]]
+        for command in commands.replace(' ', ''):
+            state = PartialScan._applyCommand(state, command)
+            views.append(state.get_plane_representation()[self._cameraFace])
+        return views
+
+    # ----------------------------------------------------------------------
+
+    def stateAfter(state, commands):
+        """
+        Get the cube (as seen by the device) after the scan, e.g., to solve it.
+        """
+        for command in commands.replace(' ', ''):
+            state = PartialScan._applyCommand(state, command)
+        return state
+
+# ========== Main (sample scan sequences) ==========
+
+if __name__ == '__main__':
+    import random
+    from PCubeAction import Action
+
+    scanner = PartialScan()
+    fullMs = PartialScan.scanTimeMs(PartialScan.FULL_SCAN)
+    fullSufficient = PartialScan.isSufficient(sticker for view in scanner.seenStickers(PartialScan.FULL_SCAN) for sticker in view)
+    print(f'Full scan {PartialScan.FULL_SCAN}: {fullMs / 1000.0:4.1f} s (sufficient: {fullSufficient})')
+    for angleDegree in [0, 90, 180, 270]:
+        commands, scanMs, finalDegree = scanner.plan(angleDegree)
+        print(f'Start at {angleDegree:3}°: {commands:<8} {scanMs / 1000.0:4.1f} s, {len(commands)} commands, final angle {finalDegree:3}°')
+
+    # Infer random cubes (any orientation in the device) from the planned scan
+    commands, _, _ = scanner.plan()
+    numberCorrect = 0
+    for _ in range(1000):
+        state = State()
+        for _ in range(random.randint(0, 20)):
+            state = state.next_state(random.choice(list(Action)))
+        for _ in range(random.randint(0, 3)):
+            state = PartialScan._applyCommand(state, 'T')
+        decoded = scanner.decode(commands, scanner.views(state, commands))
+        numberCorrect += (decoded.positions == state.positions) and (decoded.orientations == state.orientations)
+    print(f'Decoded {numberCorrect} of 1000 random cubes from {commands}')
@@ -5,12 +5,13 @@ Control mechanical movements of 2x2x2 Pocket Cube by Arduino board using USB.
 @contact: http://www.haw-hamburg.de/marc-hensel
 
 @copyright: 2023, Marc Hensel
-@version: 2023.07.29
+@version: 2026.10.18
 @license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
 """
 
 import time
 from ArduinoCOM import ArduinoCOM
+from SolveTrace import SolveTrace
 
 class PocketCube():
     
@@ -130,12 +131,23 @@ class PocketCube():
         # Scan cube for colors
         'Scan colors' : { 'ReCor': 'RRRRTT RRRRTT', 'SpiCor': 'RRRRTT RRRRTT'}
     }
+
+    # Names of events recorded by the firmware (see Trace.h)
+    _deviceEventNames = {
+        '<': 'serial receive',
+        'I': 'servo init',
+        'L': 'servo rotate left',
+        'R': 'servo rotate right',
+        'T': 'servo turn',
+        '>': 'acknowledge',
+        'P': 'solve on device'
+    }
     
     # ----------------------------------------------------------------------
     # Constructor
     # ----------------------------------------------------------------------
 
-    def __init__(self, mode = 'SpiCor', serialCOM = None):
+    def __init__(self, mode = 'SpiCor', serialCOM = None, trace = None):
         """
         Constructor, tries to connects to Arduino using serial COM ports.
         
@@ -151,6 +163,8 @@ class PocketCube():
         serialCOM : int, optional
             Serial port Arduino is connected to (e.g., '3' for 'COM3').
             Tries to connect to ports 0 to 15, if argument is None. (Default: None)
+        trace : SolveTrace, optional
+            Records the latency breakdown of solves. Tracing is disabled, if None. (Default: None)
 
         Returns
         -------
@@ -158,7 +172,8 @@ class PocketCube():
 
         """
         # Connect to Arduino (will reset Arduino => Runs setup())
-        self._arduino = ArduinoCOM(serialCOM=serialCOM)
+        self._arduino = ArduinoCOM(serialCOM=serialCOM, trace=trace)
+        self.trace = self._arduino.trace
         reply = self._arduino.readLine()
         print('Device ready: ' + reply)
         
@@ -216,17 +231,23 @@ class PocketCube():
         None.
 
         """
+        with self.trace.span('rotate', rotation=rotation):
+            self._rotateCube(rotation)
+
+    def _rotateCube(self, rotation):
         # Determine relative rotation (i.e., rotation in standard orientation)
-        if self._mode == 'SpiCor':
-            logicalRotation = rotation
-            rotation = self._relativeRotation(rotation)
-            print('Relative rotation {} -> {}'.format(logicalRotation, rotation))
+        with self.trace.span('plan'):
+            if self._mode == 'SpiCor':
+                logicalRotation = rotation
+                rotation = self._relativeRotation(rotation)
+                print('Relative rotation {} -> {}'.format(logicalRotation, rotation))
+            commands = PocketCube._rotation2servoCmd[rotation][self._mode]
             
         # Move servos
-        commands = PocketCube._rotation2servoCmd[rotation][self._mode]
         print('Rotation commands {} -> {}'.format(rotation, commands))
         self._arduino.writeString(commands + '>')
-        reply = self._arduino.readLine()
+        with self.trace.span('wait for device'):
+            reply = self._arduino.readLine()
         print('Reply: ' + str(reply))
 
         # SpiCor: update location of cube's logical faces
@@ -275,12 +296,133 @@ class PocketCube():
         # Return 180 degree rotation (X2)
         elif len(rotation) == 2:
             return face + '2'
-            
+
+    # ----------------------------------------------------------------------
+    # Solve on device
+    # ----------------------------------------------------------------------
+
+    @staticmethod
+    def packState(positions, orientations):
+        """
+        Pack a state into 10 hex digits sent with command 'P' (see Solver.cpp).
+
+        Parameters
+        ----------
+        positions : list(int)
+            Cubie at each position 0..7 (same as State.positions).
+        orientations : list(int)
+            Orientation at each position 0..7 (same as State.orientations).
+
+        Returns
+        -------
+        string
+            Packed state (5 bytes as hex digits, least significant byte first).
+
+        """
+        bits = 0
+        for i in range(8):
+            bits |= positions[i] << (3 * i)
+            bits |= orientations[i] << (24 + 2 * i)
+        return bits.to_bytes(5, 'little').hex().upper()
+
+    def solveOnDevice(self, positions, orientations):
+        """
+        Let the Arduino solve a scanned state and execute the solution.
+
+        The firmware finds a solution with the minimum number of face turns
+        and plans the servo commands itself, i.e., the host sends a single
+        command. The cube must be in standard orientation (e.g., after
+        scanning its colors).
+
+        Parameters
+        ----------
+        positions : list(int)
+            Cubie at each position 0..7 (same as State.positions).
+        orientations : list(int)
+            Orientation at each position 0..7 (same as State.orientations).
+
+        Returns
+        -------
+        list(string)
+            Rotations of the solution (e.g., ['R', 'u', 'F2']), or None if the state is invalid.
+
+        """
+        with self.trace.span('solve on device'):
+            self._arduino.writeString('P' + PocketCube.packState(positions, orientations) + '>')
+            with self.trace.span('wait for device'):
+                reply = self._arduino.readLine()
+                ack = self._arduino.readLine()
+        print('Reply: {} {}'.format(reply, ack))
+        if (reply is None) or not reply.startswith('solution'):
+            return None
+        rotations = reply.split()[1:]
+
+        # SpiCor: update location of cube's logical faces as moved by the device
+        if self._mode == 'SpiCor':
+            self._orientationFront, self._orientationRight, self._orientationUp = '+x', '+y', '+z'
+            for rotation in rotations:
+                rotation = self._relativeRotation(rotation)
+                self._orientationFront = PocketCube._nextOrientation[self._orientationFront][rotation]
+                self._orientationUp = PocketCube._nextOrientation[self._orientationUp][rotation]
+                self._orientationRight = PocketCube._nextOrientation[self._orientationRight][rotation]
+        return rotations
+
+    # ----------------------------------------------------------------------
+    # Latency breakdown
+    # ----------------------------------------------------------------------
+
+    def fetchDeviceTrace(self):
+        """
+        Read the events recorded by the firmware and add them to the trace.
+
+        The Arduino replies to '?' with its current time, followed by the
+        recorded events, the number of events dropped by the ring buffer, and
+        'end'. The device time is converted to host time using the time the
+        first reply line was received minus its transfer time at the
+        connection's baud rate.
+
+        Returns
+        -------
+        None.
+
+        """
+        if not self.trace.enabled:
+            return
+
+        # Request events and align clocks ("now <us>")
+        self._arduino.writeString('?')
+        line = self._arduino.readLine()
+        hostUs = self.trace.hostTimeUs() - self._arduino.transferTimeUs(len(line) + 2)
+        deviceNowUs = int(line.split()[1])
+        offsetUs = hostUs - deviceNowUs
+
+        # Read events ("trace <command> <start us> <end us>") and dropped events ("dropped <number>") until "end"
+        events, numberDropped = [], 0
+        line = self._arduino.readLine()
+        while (line is not None) and (line.rstrip() != 'end'):
+            if line.startswith('dropped'):
+                numberDropped = int(line.split()[1])
+                line = self._arduino.readLine()
+                continue
+            _, command, startUs, endUs = line.split()
+            startUs, endUs = int(startUs), int(endUs)
+            if startUs > deviceNowUs:               # micros() overflow (after about 70 minutes)
+                startUs -= 2**32
+            if endUs > deviceNowUs:
+                endUs -= 2**32
+            events.append((PocketCube._deviceEventNames.get(command, command), startUs, endUs))
+            line = self._arduino.readLine()
+        self.trace.addDeviceEvents(events, offsetUs, numberDropped)
+
 # ========== Main (sample movements of Pocket cube solver) ==========
 
 if __name__ == '__main__':
-    cube = PocketCube(mode='SpiCor', serialCOM=None)
+    trace = SolveTrace(enabled=True)
+    cube = PocketCube(mode='SpiCor', serialCOM=None, trace=trace)
+    trace.beginSolve('Sample movements')
     cube.rotateCube('F')
     cube.rotateCube('f')
+    cube.fetchDeviceTrace()
+    trace.saveChromeTrace('SampleMovementsTrace.json')
     cube.close()
 
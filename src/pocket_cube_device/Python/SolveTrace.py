@@ -0,0 +1,264 @@
+"""
+Latency breakdown of physical Pocket cube solves.
+
+Spans (named time intervals) are recorded around the stages of a solve on the
+host (e.g., scanning, solving, planning, serial transfer) and merged with the
+events recorded by the Arduino firmware (serial receive, servo motions). The
+device timestamps are converted to the host clock, so that each solve results
+in one timeline. Timelines are saved in the Chrome trace event format, which
+can be opened in chrome://tracing or https://ui.perfetto.dev.
+
+When tracing is disabled, span() returns a shared object whose enter and exit
+methods do nothing, so that instrumented code can stay in production.
+
+Usage:
+    trace = SolveTrace(enabled=True)
+    trace.beginSolve('Solve 1')
+    with trace.span('solve'):
+        ...
+    trace.saveChromeTrace('solve1.json')
+
+@author: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+
+@copyright: 2026, Marc Hensel
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+import json
+import time
+
+class _NullSpan():
+    """
+    Span doing nothing (used when tracing is disabled).
+    """
+    def __enter__(self):
+        return self
+
+    def __exit__(self, excType, excValue, traceback):
+        return False
+
+# ----------------------------------------------------------------------
+
+class _Span():
+    """
+    Span recording its start and end time when used in a 'with' statement.
+    """
+    def __init__(self, trace, name, category, args):
+        self._trace = trace
+        self._name = name
+        self._category = category
+        self._args = args
+
+    def __enter__(self):
+        self._startNs = time.perf_counter_ns()
+        return self
+
+    def __exit__(self, excType, excValue, traceback):
+        endNs = time.perf_counter_ns()
+        self._trace._addHostEvent(self._name, self._category, self._startNs, endNs, self._args)
+        return False
+
+# ----------------------------------------------------------------------
+
+class SolveTrace():
+
+    # ----------------------------------------------------------------------
+    # Class constants
+    # ----------------------------------------------------------------------
+
+    # Process IDs of the timelines in the trace viewer
+    _hostPID = 1
+    _devicePID = 2
+
+    # Shared span of disabled traces
+    _nullSpan = _NullSpan()
+
+    # ----------------------------------------------------------------------
+    # Constructor
+    # ----------------------------------------------------------------------
+
+    def __init__(self, enabled=True):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        enabled : bool, optional
+            Record spans? If False, all methods return immediately. (Default: True)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.enabled = enabled
+        self.beginSolve('Solve')
+
+    # ----------------------------------------------------------------------
+
+    def beginSolve(self, label):
+        """
+        Start a new timeline (discarding events of the previous solve).
+
+        Parameters
+        ----------
+        label : string
+            Name of the solve (shown as process name in the trace viewer).
+
+        Returns
+        -------
+        None.
+
+        """
+        self._label = label
+        self._events = []
+        self.droppedDeviceEvents = 0
+        self._originNs = time.perf_counter_ns()
+
+    # ----------------------------------------------------------------------
+    # Record events
+    # ----------------------------------------------------------------------
+
+    def span(self, name, category='host', **args):
+        """
+        Get a span to record a stage using a 'with' statement.
+
+        Parameters
+        ----------
+        name : string
+            Name of the stage (e.g., 'scan', 'solve', 'serial write').
+        category : string, optional
+            Category of the stage. (Default: 'host')
+        **args
+            Additional values shown with the event in the trace viewer.
+
+        Returns
+        -------
+        object
+            Context manager recording the span (no-op if tracing is disabled).
+
+        """
+        if not self.enabled:
+            return SolveTrace._nullSpan
+        return _Span(self, name, category, args)
+
+    # ----------------------------------------------------------------------
+
+    def hostTimeUs(self, timeNs=None):
+        """
+        Convert a time of time.perf_counter_ns() to microseconds since the start of the solve.
+        """
+        if timeNs is None:
+            timeNs = time.perf_counter_ns()
+        return (timeNs - self._originNs) / 1000.0
+
+    # ----------------------------------------------------------------------
+
+    def _addHostEvent(self, name, category, startNs, endNs, args):
+        self._events.append({
+            'name': name, 'cat': category, 'ph': 'X',
+            'ts': self.hostTimeUs(startNs), 'dur': (endNs - startNs) / 1000.0,
+            'pid': SolveTrace._hostPID, 'tid': 1, 'args': args
+        })
+
+    # ----------------------------------------------------------------------
+
+    def addDeviceEvents(self, events, offsetUs, numberDropped=0):
+        """
+        Add events recorded by the firmware.
+
+        Parameters
+        ----------
+        events : list((string, int, int))
+            Events as (name, start, end) in the device clock [us].
+        offsetUs : float
+            Host time [us since start of solve] minus device time [us].
+        numberDropped : int, optional
+            Number of earliest events overwritten in the firmware's ring buffer. (Default: 0)
+
+        Returns
+        -------
+        None.
+
+        """
+        if not self.enabled:
+            return
+        if numberDropped > 0:
+            self.droppedDeviceEvents += numberDropped
+            print(f'Warning: {numberDropped} device events dropped (increase TRACE_BUFFER_SIZE in Config.h or fetch events more often)')
+        for name, startUs, endUs in events:
+            self._events.append({
+                'name': name, 'cat': 'device', 'ph': 'X',
+                'ts': startUs + offsetUs, 'dur': endUs - startUs,
+                'pid': SolveTrace._devicePID, 'tid': 1, 'args': {}
+            })
+
+    # ----------------------------------------------------------------------
+    # Export
+    # ----------------------------------------------------------------------
+
+    def summary(self):
+        """
+        Get the total duration per event name.
+
+        Returns
+        -------
+        dict
+            Duration [ms] for each event name (host and device events).
+
+        """
+        totals = {}
+        for event in self._events:
+            totals[event['name']] = totals.get(event['name'], 0.0) + event['dur'] / 1000.0
+        return totals
+
+    # ----------------------------------------------------------------------
+
+    def saveChromeTrace(self, fileName):
+        """
+        Save the timeline of the current solve in the Chrome trace event format.
+
+        Parameters
+        ----------
+        fileName : string
+            Name of the JSON file to write.
+
+        Returns
+        -------
+        None.
+
+        """
+        if not self.enabled:
+            return
+        metadata = [
+            {'name': 'process_name', 'ph': 'M', 'pid': SolveTrace._hostPID, 'args': {'name': self._label + ' (host)'}},
+            {'name': 'process_name', 'ph': 'M', 'pid': SolveTrace._devicePID, 'args': {'name': self._label + ' (Arduino)'}}
+        ]
+        if self.droppedDeviceEvents > 0:
+            metadata.append({'name': 'process_labels', 'ph': 'M', 'pid': SolveTrace._devicePID,
+                             'args': {'labels': f'{self.droppedDeviceEvents} earliest events dropped'}})
+        with open(fileName, 'w') as file:
+            json.dump({'traceEvents': metadata + self._events, 'displayTimeUnit': 'ms'}, file)
+
+# ========== Main (sample trace without device) ==========
+
+if __name__ == '__main__':
+    trace = SolveTrace(enabled=True)
+    trace.beginSolve('Sample solve')
+    with trace.span('scan'):
+        time.sleep(0.05)
+    with trace.span('solve', moves=3):
+        time.sleep(0.01)
+    trace.addDeviceEvents([('motion R', 0, 650_000)], trace.hostTimeUs())
+    print(trace.summary())
+    trace.saveChromeTrace('SampleSolveTrace.json')
+
+    # Cost of disabled spans
+    trace = SolveTrace(enabled=False)
+    startNs = time.perf_counter_ns()
+    for _ in range(100_000):
+        with trace.span('disabled'):
+            pass
+    print('Disabled span: {:.0f} ns'.format((time.perf_counter_ns() - startNs) / 100_000))
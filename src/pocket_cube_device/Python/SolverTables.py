@@ -0,0 +1,299 @@
+"""
+Generate the tables of the solver in the Arduino firmware (SolverTables.h).
+
+The firmware solves packed states on the device by IDA* (see Solver.cpp).
+The tables are stored in flash (PROGMEM) and generated from the Pocket cube
+environment and class PocketCube, so that both use the same definitions:
+
+- Pattern databases: minimum number of face turns (R, U, F; quarter and half
+  turns) to solve the positions of cubies 0..6 (5040 entries) and the
+  orientations of positions 0..5 (729 entries), two entries per byte.
+- Moves of the 9 face turns in the canonical frame (cubie 7 at position 7).
+- Rotations of the 24 frames to the canonical frame (see class StateCode)
+  and the faces turned instead of R, U, F in each frame.
+- Servo commands of face rotations in 'SpiCor' mode (see class PocketCube).
+
+Run the script after changing the environment or PocketCube._rotation2servoCmd.
+
+@author: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+
+@copyright: 2026, Marc Hensel
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add Pocket cube env to path
+import os
+import sys
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'pocket_cube_gym'))
+
+# Other imports
+import numpy as np
+from PCubeAction import Action
+from PCubeState import State
+from PCubeCode import StateCode
+from PocketCube import PocketCube
+
+class SolverTables():
+
+    # ----------------------------------------------------------------------
+    # Class constants
+    # ----------------------------------------------------------------------
+
+    # Faces of rotations in the firmware (rotation = 3 * face + turn, opposite face = face ^ 1)
+    FACES = 'UDFBRL'
+
+    # Faces turned by the solver (canonical frame)
+    SOLVER_ACTIONS = (Action.R, Action.U, Action.F)
+
+    # Orientation identifiers of class PocketCube
+    ORIENTATIONS = ('+x', '-x', '+y', '-y', '+z', '-z')
+
+    # Default output file
+    DEFAULT_FILE = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'Arduino', 'PocketCube', 'SolverTables.h')
+
+    # ----------------------------------------------------------------------
+    # Solver tables
+    # ----------------------------------------------------------------------
+
+    def solverMoves():
+        """
+        Get positions and orientation changes of the 9 face turns (R, R', R2, U, ...).
+
+        Returns
+        -------
+        list(tuple)
+            (positions, orientations) of positions 0..6 after each turn of the solved cube.
+
+        """
+        moves = []
+        for action in SolverTables.SOLVER_ACTIONS:
+            for actions in ([action], [action.inverse_action()], [action, action]):
+                state = State()
+                for a in actions:
+                    state = state.next_state(a)
+                assert state.positions[7] == 7 and state.orientations[7] == 0
+                moves.append((state.positions[:7], state.orientations[:7]))
+        return moves
+
+    # ----------------------------------------------------------------------
+
+    def patternDistances(moveTable):
+        """
+        Get the minimum number of face turns of each coordinate (breadth-first search).
+
+        Parameters
+        ----------
+        moveTable : numpy.ndarray of shape (N, 12)
+            Coordinate after each action in the canonical frame (e.g., StateCode.POSITION_MOVES).
+
+        Returns
+        -------
+        numpy.ndarray of shape (N,) and dtype uint8
+            Distance of each coordinate to coordinate 0.
+
+        """
+        quarterTurns = [action.value for action in SolverTables.SOLVER_ACTIONS]
+        quarterTurns += [action.inverse_action().value for action in SolverTables.SOLVER_ACTIONS]
+        distances = np.full(len(moveTable), 255, dtype=np.uint8)
+        distances[0] = 0
+        frontier, depth = np.array([0]), 0
+        while len(frontier) > 0:
+            depth += 1
+            successors = [moveTable[frontier, a] for a in quarterTurns]
+            successors += [moveTable[moveTable[frontier, a], a] for a in quarterTurns[:3]]
+            successors = np.unique(np.concatenate(successors))
+            frontier = successors[distances[successors] == 255]
+            distances[frontier] = depth
+        assert distances.max() < 16
+        return distances
+
+    # ----------------------------------------------------------------------
+
+    def frameFaces():
+        """
+        Get the faces turned in each frame instead of R, U, F in the canonical frame.
+
+        The faces do not move cubie 7, i.e., the frame does not change.
+
+        Returns
+        -------
+        list(list(int))
+            Face index (in SolverTables.FACES) for each frame and solver action.
+
+        """
+        faces = []
+        for frame in range(24):
+            frameFaces = []
+            for canonical in SolverTables.SOLVER_ACTIONS:
+                action = next(a for a in Action if StateCode.FRAME_ACTIONS[frame, a.value] == canonical.value
+                              and StateCode.NEXT_FRAMES[frame, a.value] == frame)
+                assert action.value < 6
+                assert StateCode.FRAME_ACTIONS[frame, action.inverse_action().value] == canonical.inverse_action().value
+                frameFaces.append(SolverTables.FACES.index(action.name))
+            faces.append(frameFaces)
+        return faces
+
+    # ----------------------------------------------------------------------
+    # Servo commands
+    # ----------------------------------------------------------------------
+
+    def rotationNames():
+        """
+        Get the names of the 18 face rotations (e.g., 'U', 'u', 'U2') as used by class PocketCube.
+        """
+        return [name for face in SolverTables.FACES for name in (face, face.lower(), face + '2')]
+
+    # ----------------------------------------------------------------------
+
+    def servoTables():
+        """
+        Get the servo commands and orientation changes of the rotations in 'SpiCor' mode.
+
+        Returns
+        -------
+        commands : list(string)
+            Servo commands of each rotation (without spaces and brackets).
+        nextOrientations : list(list(int))
+            Orientation index after each rotation for each orientation index.
+        orientationFaces : list(int)
+            Face index of each orientation index.
+
+        """
+        names = SolverTables.rotationNames()
+        commands = [''.join(c for c in PocketCube._rotation2servoCmd[name]['SpiCor'] if c in 'LRT') for name in names]
+        nextOrientations = [[SolverTables.ORIENTATIONS.index(PocketCube._nextOrientation[orientation][name]) for name in names]
+                            for orientation in SolverTables.ORIENTATIONS]
+        orientationFaces = [SolverTables.FACES.index(PocketCube._orientation2Face[o]) for o in SolverTables.ORIENTATIONS]
+        return commands, nextOrientations, orientationFaces
+
+    # ----------------------------------------------------------------------
+    # Write header file
+    # ----------------------------------------------------------------------
+
+    def _array(declaration, values, perLine=24):
+        """
+        Get the C definition of a PROGMEM array of integers.
+        """
+        values = [str(int(v)) for v in np.asarray(values).reshape(-1)]
+        lines = [', '.join(values[i:i + perLine]) for i in range(0, len(values), perLine)]
+        return declaration + ' PROGMEM = {\n  ' + ',\n  '.join(lines) + '\n};\n'
+
+    # ----------------------------------------------------------------------
+
+    def _packNibbles(values):
+        """
+        Pack values into 4 bits each (entry i in byte i / 2, low nibble first).
+        """
+        values = np.asarray(values, dtype=np.uint8)
+        if len(values) % 2 == 1:
+            values = np.append(values, np.uint8(0))
+        return values[0::2] | (values[1::2] << 4)
+
+    # ----------------------------------------------------------------------
+
+    def writeHeader(fileName=None):
+        """
+        Generate the tables and write them as C header file.
+
+        Parameters
+        ----------
+        fileName : string, optional
+            Header file. (Default: None, i.e., SolverTables.DEFAULT_FILE)
+
+        Returns
+        -------
+        None.
+
+        """
+        fileName = SolverTables.DEFAULT_FILE if fileName is None else fileName
+        positionDistances = SolverTables.patternDistances(StateCode.POSITION_MOVES)
+        orientationDistances = SolverTables.patternDistances(StateCode.ORIENTATION_MOVES)
+        moves = SolverTables.solverMoves()
+        frameRotations = StateCode._StateCode__frame_rotations
+        commands, nextOrientations, orientationFaces = SolverTables.servoTables()
+        commandLength = max(len(c) for c in commands) + 1
+
+        with open(fileName, 'w') as file:
+            file.write(f'''/*****************************************************************************************************
+ * Tables of the Pocket cube solver (generated by SolverTables.py, do not edit).
+ *****************************************************************************************************
+ * Author: Marc Hensel, http://www.haw-hamburg.de/marc-hensel
+ * Project: https://github.com/MarcOnTheMoon/cubes
+ * Copyright: 2026, Marc Hensel
+ * Version: 2026.10.18
+ * License: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+ *****************************************************************************************************
+ * Pattern databases (two entries per byte, entry i in byte i / 2, low nibble first):
+ * - POSITION_DISTANCES: Face turns to solve the positions of cubies 0..6 by permutation rank
+ * - ORIENTATION_DISTANCES: Face turns to solve the orientations of positions 0..5 (base 3)
+ *
+ * Rotations are indexed by 3 * face + turn with faces "{SolverTables.FACES}" and turns (90°, -90°, 180°).
+ *****************************************************************************************************/
+
+#ifndef _SOLVER_TABLES_H_
+#define _SOLVER_TABLES_H_
+
+#include <Arduino.h>
+
+#define NUMBER_POSITION_RANKS {StateCode.NUMBER_POSITIONS}
+#define NUMBER_ORIENTATION_CODES {StateCode.NUMBER_ORIENTATIONS}
+#define NUMBER_SOLVER_MOVES {len(moves)}
+#define NUMBER_FRAMES 24
+#define NUMBER_ROTATIONS {len(commands)}
+#define SERVO_COMMAND_LENGTH {commandLength}
+
+/*****************************************************************************************************
+ * Pattern databases
+ *****************************************************************************************************/
+
+''')
+            file.write(SolverTables._array('const uint8_t POSITION_DISTANCES[(NUMBER_POSITION_RANKS + 1) / 2]',
+                                           SolverTables._packNibbles(positionDistances)))
+            file.write('\n')
+            file.write(SolverTables._array('const uint8_t ORIENTATION_DISTANCES[(NUMBER_ORIENTATION_CODES + 1) / 2]',
+                                           SolverTables._packNibbles(orientationDistances)))
+            file.write('''
+/*****************************************************************************************************
+ * Solver moves R, R', R2, U, U', U2, F, F', F2 in the canonical frame:
+ * position i receives the cubie from position MOVE_POSITIONS[m][i] and adds MOVE_ORIENTATIONS[m][i]
+ *****************************************************************************************************/
+
+''')
+            file.write(SolverTables._array('const uint8_t MOVE_POSITIONS[NUMBER_SOLVER_MOVES][7]', [m[0] for m in moves], 7))
+            file.write(SolverTables._array('const uint8_t MOVE_ORIENTATIONS[NUMBER_SOLVER_MOVES][7]', [m[1] for m in moves], 7))
+            file.write('''
+/*****************************************************************************************************
+ * Frames (frame = 3 * position of cubie 7 + its orientation):
+ * - Canonical position i receives the cubie from position FRAME_POSITIONS[f][i] and adds FRAME_ORIENTATIONS[f][i]
+ * - FRAME_FACES[f][j]: Face turned instead of R, U, F (j = 0, 1, 2) in the canonical frame
+ *****************************************************************************************************/
+
+''')
+            file.write(SolverTables._array('const uint8_t FRAME_POSITIONS[NUMBER_FRAMES][8]', [r[0] for r in frameRotations], 8))
+            file.write(SolverTables._array('const uint8_t FRAME_ORIENTATIONS[NUMBER_FRAMES][8]', [r[1] for r in frameRotations], 8))
+            file.write(SolverTables._array('const uint8_t FRAME_FACES[NUMBER_FRAMES][3]', SolverTables.frameFaces(), 12))
+            file.write('''
+/*****************************************************************************************************
+ * Servo commands in 'SpiCor' mode (see PocketCube.py):
+ * - Orientations: +x, -x, +y, -y, +z, -z (location of the front, right, and up face)
+ * - ORIENTATION_FACES[o]: Face at orientation o
+ * - NEXT_ORIENTATIONS[o][r]: Orientation after rotation r
+ * - SERVO_COMMANDS[r]: Servo commands of rotation r
+ *****************************************************************************************************/
+
+''')
+            file.write(SolverTables._array('const uint8_t ORIENTATION_FACES[6]', orientationFaces))
+            file.write(SolverTables._array('const uint8_t NEXT_ORIENTATIONS[6][NUMBER_ROTATIONS]', nextOrientations, 18))
+            file.write('const char SERVO_COMMANDS[NUMBER_ROTATIONS][SERVO_COMMAND_LENGTH] PROGMEM = {\n  '
+                       + ',\n  '.join(f'"{c}"' for c in commands) + '\n};\n')
+            file.write('\n#endif\n')
+
+        print(f'Wrote {fileName}: maximum distances {positionDistances.max()} (positions), '
+              f'{orientationDistances.max()} (orientations)')
+
+# ========== Main (generate tables) ==========
+
+if __name__ == '__main__':
+    SolverTables.writeHeader()
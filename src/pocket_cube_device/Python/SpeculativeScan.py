@@ -0,0 +1,269 @@
+"""
+Speculative solving while the cube is still being scanned.
+
+Each view of the camera narrows the states matching the colors seen so far
+(refer to class PartialScan). Instead of waiting for the scan to finish,
+the device executes servo commands that are part of a fastest solution for
+all remaining candidates:
+
+1. Get the candidate states matching the views so far.
+2. Look up the remaining time of the fastest program of each candidate
+   and of its successors after each servo command (one batch of table
+   lookups for all candidates, refer to class DeviceMacroTable).
+3. A command is safe if it starts a fastest program for every candidate.
+   Safe commands are taken only if they do not lengthen the rest of the
+   (re-planned) scan and, for every candidate, the total time of the
+   command, the rest of the scan, and the fastest program afterwards does
+   not exceed the total time of executing the scan's next command instead.
+   Of these, execute the command with the least mean total time.
+4. The camera sees the cube after each command, i.e., solution commands
+   scan as well. Stop when a single candidate is left (possibly before the
+   scan is complete) and execute the rest of its fastest program.
+
+Hence, a speculative command never delays the scan and never lengthens the
+total time of the actual cube compared to continuing the scan. Speculation is
+skipped while more than maxCandidates states match (e.g., after the first
+view). The scan is re-planned after each view, so that the total time can
+still differ from scanning with a fixed scan (refer to the sample).
+
+@author: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+
+@copyright: 2026, Marc Hensel
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add Pocket cube env to path
+import os
+import sys
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'pocket_cube_gym'))
+
+# Other imports
+import numpy as np
+from PCubeCode import StateCode
+from PartialScan import PartialScan
+from DeviceMacroTable import DeviceMacroTable
+
+class SpeculativeScan():
+
+    # ----------------------------------------------------------------------
+    # Class constants
+    # ----------------------------------------------------------------------
+
+    # Frame after turning the cube for each frame
+    _turnFrames = DeviceMacroTable._turnFrames()
+
+    # ----------------------------------------------------------------------
+    # Constructor
+    # ----------------------------------------------------------------------
+
+    def __init__(self, table, scanner=None, maxCandidates=20_000):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        table : DeviceMacroTable
+            Tables of the fastest servo programs.
+        scanner : PartialScan, optional
+            Scan model and planner. (Default: None, i.e., PartialScan())
+        maxCandidates : int, optional
+            Maximum number of candidate states to speculate on. (Default: 20_000)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.table = table
+        self.scanner = PartialScan() if scanner is None else scanner
+        self.maxCandidates = maxCandidates
+
+    # ----------------------------------------------------------------------
+    # Speculation
+    # ----------------------------------------------------------------------
+
+    def safeCommands(self, states, angleDegree):
+        """
+        Get the servo commands starting a fastest program for all states.
+
+        Parameters
+        ----------
+        states : list(State)
+            Candidate cubes as seen by the device.
+        angleDegree : int
+            Rotation servo angle in [0, 90, 180, 270].
+
+        Returns
+        -------
+        list(string)
+            Safe commands (subset of DeviceMacroTable.COMMANDS).
+
+        """
+        actionR, actionL, _ = DeviceMacroTable._cubeMoves()
+        codes = np.array([StateCode.encode(state) for state in states], dtype=np.int64)
+        frames = np.array([StateCode.frame(state) for state in states], dtype=np.int64)
+        angle = angleDegree // 90
+        times = self.table.times[DeviceMacroTable._index(codes, frames, angle)].astype(np.int64)
+        if (times == 0).any():
+            return []
+
+        safe = []
+        for value, command in enumerate(DeviceMacroTable.COMMANDS):
+            commandMs, nextAngle = DeviceMacroTable.commandTimeMs(value, angle)
+            if command == 'T':
+                nextCodes, nextFrames = codes, SpeculativeScan._turnFrames[frames]
+            else:
+                action = (actionR if command == 'R' else actionL).value
+                nextCodes = StateCode.next_codes(codes, StateCode.FRAME_ACTIONS[frames, action])
+                nextFrames = StateCode.NEXT_FRAMES[frames, action]
+            nextTimes = self.table.times[DeviceMacroTable._index(nextCodes.astype(np.int64), nextFrames.astype(np.int64), nextAngle)]
+            if (nextTimes.astype(np.int64) + commandMs == times).all():
+                safe.append(command)
+        return safe
+
+    # ----------------------------------------------------------------------
+
+    def nextCommand(self, commands, views, angleDegree):
+        """
+        Decide the next servo command from the colors seen so far.
+
+        Parameters
+        ----------
+        commands : string
+            Servo commands executed since the start of the scan.
+        views : list(list(char))
+            Colors of the camera face before the first and after each command.
+        angleDegree : int
+            Current rotation servo angle in [0, 90, 180, 270].
+
+        Raises
+        ------
+        ValueError
+            If no state matches the views (inconsistent scan).
+
+        Returns
+        -------
+        tuple(string, list(State))
+            Next servo command (None if the cube is known) and the candidate
+            states before the scan (None if more than maxCandidates).
+
+        """
+        candidates = self.scanner.candidates(commands, views, self.maxCandidates)
+        if len(candidates) == 0:
+            raise ValueError(f'No state matches the views after commands "{commands}" (inconsistent scan)')
+        if len(candidates) == 1:
+            return None, candidates
+        scanCommands, scanMs, _ = self.scanner.plan(angleDegree, commands)
+        if len(candidates) > self.maxCandidates:
+            return scanCommands[0], None
+
+        # Safe commands not delaying the scan and not lengthening the total time of any candidate
+        states = [PartialScan.stateAfter(state, commands) for state in candidates]
+        scanTotalsMs = self._totalTimesMs(candidates, commands, angleDegree, scanCommands[0])[1]
+        bestCommand, bestMeanMs = scanCommands[0], scanTotalsMs.mean()
+        for command in self.safeCommands(states, angleDegree):
+            if command == scanCommands[0]:
+                continue
+            commandScanMs, totalsMs = self._totalTimesMs(candidates, commands, angleDegree, command)
+            if (commandScanMs <= scanMs) and (totalsMs <= scanTotalsMs).all() and (totalsMs.mean() < bestMeanMs):
+                bestCommand, bestMeanMs = command, totalsMs.mean()
+        return bestCommand, candidates
+
+    # ----------------------------------------------------------------------
+
+    def _totalTimesMs(self, candidates, commands, angleDegree, command):
+        """
+        Get the time [ms] of a command and the rest of the scan, and the total time [ms] per candidate including the fastest program.
+        """
+        commandMs, angle = DeviceMacroTable.commandTimeMs(DeviceMacroTable.COMMANDS.index(command), angleDegree // 90)
+        scanCommands, scanMs, finalDegree = self.scanner.plan(90 * angle, commands + command)
+        states = [PartialScan.stateAfter(state, commands + command + scanCommands) for state in candidates]
+        return commandMs + scanMs, commandMs + scanMs + self._remainingTimesMs(states, finalDegree)
+
+    # ----------------------------------------------------------------------
+
+    def _remainingTimesMs(self, states, angleDegree):
+        """
+        Get the time [ms] of the fastest program of each state (one batch of table lookups).
+        """
+        codes = np.array([StateCode.encode(state) for state in states], dtype=np.int64)
+        frames = np.array([StateCode.frame(state) for state in states], dtype=np.int64)
+        return self.table.times[DeviceMacroTable._index(codes, frames, angleDegree // 90)].astype(np.int64)
+
+    # ----------------------------------------------------------------------
+    # Simulation
+    # ----------------------------------------------------------------------
+
+    def run(self, state, angleDegree=0):
+        """
+        Simulate scanning and solving a cube with speculative commands.
+
+        Parameters
+        ----------
+        state : State
+            Cube as seen by the device before the scan.
+        angleDegree : int, optional
+            Rotation servo angle in [0, 90, 180, 270]. (Default: 0)
+
+        Returns
+        -------
+        tuple(string, int, int)
+            Servo commands until the cube was known, number of these commands
+            that are part of the solution program, and total time [ms] of
+            scanning and solving.
+
+        """
+        commands, angle, timeMs = '', angleDegree // 90, 0
+        views = self.scanner.views(state, commands)
+        numberSpeculative = 0
+
+        while True:
+            command, candidates = self.nextCommand(commands, views, 90 * angle)
+            if command is None:
+                break
+            if candidates is not None:
+                states = [PartialScan.stateAfter(candidate, commands) for candidate in candidates]
+                numberSpeculative += command in self.safeCommands(states, 90 * angle)
+            commandMs, angle = DeviceMacroTable.commandTimeMs(DeviceMacroTable.COMMANDS.index(command), angle)
+            timeMs += commandMs
+            commands += command
+            views = self.scanner.views(state, commands)
+
+        # Rest of the fastest program of the known cube
+        decoded = self.scanner.decode(commands, views)
+        timeMs += self.table.remainingTimeMs(PartialScan.stateAfter(decoded, commands), 90 * angle)
+        return commands, numberSpeculative, timeMs
+
+# ========== Main (sample comparison with scanning before solving) ==========
+
+if __name__ == '__main__':
+    import time
+    import random
+    from PCubeAction import Action
+    from PCubeState import State
+
+    table = DeviceMacroTable()
+    speculative = SpeculativeScan(table)
+    scanCommands, scanMs, _ = speculative.scanner.plan()
+
+    sequentialTotal = speculativeTotal = numberSlower = 0
+    numberCubes = 50
+    startTime = time.perf_counter()
+    for _ in range(numberCubes):
+        state = State()
+        for _ in range(20):
+            state = state.next_state(random.choice(list(Action)))
+
+        # Scan, then solve vs. speculative commands while scanning
+        sequentialMs = scanMs + table.remainingTimeMs(PartialScan.stateAfter(state, scanCommands))
+        commands, numberSpeculative, speculativeMs = speculative.run(state)
+        sequentialTotal += sequentialMs
+        speculativeTotal += speculativeMs
+        numberSlower += speculativeMs > sequentialMs
+        print(f'Scan then solve: {sequentialMs / 1000.0:5.1f} s, speculative: {speculativeMs / 1000.0:5.1f} s '
+              f'(known after {commands:<6}, {numberSpeculative} solution commands during the scan)')
+
+    print(f'Average: scan then solve {sequentialTotal / numberCubes / 1000.0:5.2f} s, speculative {speculativeTotal / numberCubes / 1000.0:5.2f} s '
+          f'({(time.perf_counter() - startTime) / numberCubes:.2f} s computing per cube, {numberSlower} cubes slower than scan then solve)')
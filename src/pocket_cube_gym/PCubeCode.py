@@ -0,0 +1,317 @@
+"""
+Compact integer codes of Pocket cube states.
+
+A Pocket cube has no center cubies, i.e., rotating the whole cube results in
+a different State, but in the same cube. Codes identify cubes independent of
+their orientation: a state is rotated as a whole (right-multiplied by one of
+the 24 cube rotations) so that cubie 7 is at position 7 with orientation 0.
+This 'canonical' state is encoded as
+
+    code = <rank of positions[0..6]> * 729 + <orientations[0..5] in base 3>
+
+with code in [0, 3,674,160) and code 0 denoting the solved cube. The rotation
+applied is called the frame of the state.
+
+Actions R, U, F (and r, u, f) do not move position 7. L, D, B (and l, d, b)
+are equal to R, U, F (and r, u, f) followed by a rotation of the whole cube.
+Hence, codes are moved by table lookups in two small coordinate tables
+(positions: 5040 x 12, orientations: 729 x 12).
+
+Actions in the frame of the original state map to actions in the canonical
+frame by FRAME_ACTIONS[frame][action]. Actions equal to L, D, B in the
+canonical frame rotate the cube as a whole, i.e., change the frame to
+NEXT_FRAMES[frame][action]. Hence, a sequence of actions on a state is
+followed on its code by tracking the frame.
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+import itertools
+import numpy as np
+from PCubeAction import Action
+from PCubeState import State
+
+class StateCode:
+
+    # ========== Constants ====================================================
+
+    NUMBER_POSITIONS = 5040         # 7! permutations of cubies 0..6
+    NUMBER_ORIENTATIONS = 729       # 3^6 orientations of positions 0..5
+    NUMBER_CODES = NUMBER_POSITIONS * NUMBER_ORIENTATIONS
+    SOLVED_CODE = 0
+
+    # Actions in the canonical frame equal to an action (L, D, B turn the cube as a whole, additionally)
+    __canonical_actions = (Action.R, Action.R, Action.U, Action.U, Action.F, Action.F,
+                           Action.r, Action.r, Action.u, Action.u, Action.f, Action.f)
+
+    # ========== Encode and decode states =====================================
+
+    def frame(state):
+        """
+        Get the frame (index of the cube rotation making the state canonical) in [0, 23].
+        """
+        position = state.positions.index(7)
+        return 3 * position + state.orientations[position]
+
+    # -------------------------------------------------------------------------
+
+    def encode(state):
+        """
+        Get the code of a state.
+
+        Parameters
+        ----------
+        state : State
+            State (in any orientation of the cube as a whole).
+
+        Returns
+        -------
+        int
+            Code in [0, NUMBER_CODES).
+
+        """
+        positions, orientations = StateCode._canonical(state)
+        twist = 0
+        for orientation in orientations[:6]:
+            twist = 3 * twist + orientation
+        return StateCode.__position_ranks[positions[:7]] * 729 + twist
+
+    # -------------------------------------------------------------------------
+
+    def _canonical(state):
+        """
+        Get positions and orientations of the state rotated to the canonical frame.
+        """
+        rotation_positions, rotation_orientations = StateCode.__frame_rotations[StateCode.frame(state)]
+        positions = tuple(state.positions[i] for i in rotation_positions)
+        orientations = tuple((state.orientations[i] + o) % 3 for i, o in zip(rotation_positions, rotation_orientations))
+        return positions, orientations
+
+    # -------------------------------------------------------------------------
+
+    def decode(code):
+        """
+        Get the canonical state of a code.
+
+        Parameters
+        ----------
+        code : int
+            Code in [0, NUMBER_CODES).
+
+        Returns
+        -------
+        State
+            State with cubie 7 at position 7 and orientation 0.
+
+        """
+        rank, twist = divmod(int(code), 729)
+        orientations = [0] * 8
+        for i in range(5, -1, -1):
+            twist, orientations[i] = divmod(twist, 3)
+        orientations[6] = -sum(orientations[:6]) % 3
+        return State(StateCode.__permutations[rank] + (7,), tuple(orientations))
+
+    # -------------------------------------------------------------------------
+
+    def encode_states(states):
+        """
+        Get the codes of multiple states as numpy.ndarray of dtype int32.
+        """
+        return np.array([StateCode.encode(state) for state in states], dtype=np.int32)
+
+    # ========== Apply actions ================================================
+
+    def next_code(code, action):
+        """
+        Get the code after applying an action in the canonical frame.
+
+        Parameters
+        ----------
+        code : int
+            Code in [0, NUMBER_CODES).
+        action : Action or int
+            Action (value) in the canonical frame (refer to FRAME_ACTIONS).
+
+        Returns
+        -------
+        int
+            Code of the resulting state.
+
+        """
+        a = action.value if isinstance(action, Action) else action
+        rank, twist = divmod(code, 729)
+        return int(StateCode.POSITION_MOVES[rank, a]) * 729 + int(StateCode.ORIENTATION_MOVES[twist, a])
+
+    # -------------------------------------------------------------------------
+
+    def next_codes(codes, actions):
+        """
+        Apply actions (canonical frame) to a batch of codes.
+
+        Parameters
+        ----------
+        codes : numpy.ndarray of shape (N,)
+            Codes of the states.
+        actions : numpy.ndarray of shape (N,) or int
+            Action values in [0, 11].
+
+        Returns
+        -------
+        numpy.ndarray of shape (N,) and dtype int32
+            Codes of the resulting states.
+
+        """
+        ranks, twists = np.divmod(codes, 729)
+        return StateCode.POSITION_MOVES[ranks, actions] * 729 + StateCode.ORIENTATION_MOVES[twists, actions]
+
+    # -------------------------------------------------------------------------
+
+    def successor_codes(codes):
+        """
+        Apply all 12 actions (canonical frame) to a batch of codes.
+
+        Parameters
+        ----------
+        codes : numpy.ndarray of shape (N,)
+            Codes of the states.
+
+        Returns
+        -------
+        numpy.ndarray of shape (N, 12) and dtype int32
+            Codes of the successors, indexed by state and action value.
+
+        """
+        ranks, twists = np.divmod(codes, 729)
+        return StateCode.POSITION_MOVES[ranks] * 729 + StateCode.ORIENTATION_MOVES[twists]
+
+    # ========== Create tables ================================================
+
+    def _moves():
+        """
+        Get the permutation and orientation change of each action as (positions, orientations).
+        """
+        moves = []
+        for action in Action:
+            state = State().next_state(action)
+            moves.append((state.positions, state.orientations))
+        return moves
+
+    # -------------------------------------------------------------------------
+
+    def _create_frame_rotations():
+        """
+        Get the cube rotation for each frame as (positions, orientations).
+
+        The 24 solved states are the cube rotations applied to the solved cube
+        in standard orientation. The rotation of frame 3 * p + o moves cubie 7
+        from position p with orientation o to position 7 with orientation 0.
+        """
+        rotations = [None] * 24
+        for orientations, positions_list in State._State__solved_states.items():
+            for positions in positions_list:
+                frame = 3 * positions[7] + (-orientations[7]) % 3
+                rotations[frame] = (positions, orientations)
+        return tuple(rotations)
+
+    # -------------------------------------------------------------------------
+
+    def _create_move_tables():
+        """
+        Create the coordinate tables of the positions and orientations.
+
+        Returns
+        -------
+        position_moves : numpy.ndarray of shape (5040, 12)
+            Rank of positions[0..6] after each action.
+        orientation_moves : numpy.ndarray of shape (729, 12)
+            Orientation coordinate after each action.
+
+        """
+        moves = StateCode._moves()
+        position_moves = np.zeros((StateCode.NUMBER_POSITIONS, 12), dtype=np.int32)
+        orientation_moves = np.zeros((StateCode.NUMBER_ORIENTATIONS, 12), dtype=np.int32)
+
+        for action in Action:
+            move_positions, move_orientations = moves[StateCode.__canonical_actions[action.value].value]
+            for rank, permutation in enumerate(StateCode.__permutations):
+                new_permutation = tuple(permutation[i] for i in move_positions[:7])
+                position_moves[rank, action.value] = StateCode.__position_ranks[new_permutation]
+            for twist in range(StateCode.NUMBER_ORIENTATIONS):
+                orientations = StateCode.decode(twist).orientations
+                new_twist = 0
+                for i in range(6):
+                    new_twist = 3 * new_twist + (orientations[move_positions[i]] + move_orientations[i]) % 3
+                orientation_moves[twist, action.value] = new_twist
+
+        return position_moves, orientation_moves
+
+    # -------------------------------------------------------------------------
+
+    def _create_frame_actions():
+        """
+        Map actions on a state in any frame to actions in the canonical frame.
+
+        Returns
+        -------
+        frame_actions : numpy.ndarray of shape (24, 12) and dtype int8
+            Action value in the canonical frame for each frame and action value.
+        next_frames : numpy.ndarray of shape (24, 12) and dtype int8
+            Frame after the action for each frame and action value.
+
+        """
+        frame_actions = np.zeros((24, 12), dtype=np.int8)
+        next_frames = np.zeros((24, 12), dtype=np.int8)
+
+        # Canonical state whose successors by R, U, F, r, u, f differ
+        canonical = State()
+        for action in (Action.R, Action.U, Action.F, Action.R, Action.u):
+            canonical = canonical.next_state(action)
+        canonical_code = StateCode.encode(canonical)
+        canonical = StateCode.decode(canonical_code)
+        successors = {StateCode.next_code(canonical_code, a): a for a in (0, 2, 4, 6, 8, 10)}
+        assert len(successors) == 6
+
+        for frame, (rotation_positions, rotation_orientations) in enumerate(StateCode.__frame_rotations):
+            # State in the frame (rotating it by the frame's rotation results in the canonical state)
+            inverse_positions = [rotation_positions.index(i) for i in range(8)]
+            state = State(tuple(canonical.positions[i] for i in inverse_positions),
+                          tuple((canonical.orientations[i] - rotation_orientations[i]) % 3 for i in inverse_positions))
+            assert StateCode.frame(state) == frame and StateCode.encode(state) == canonical_code
+            for action in Action:
+                next_state = state.next_state(action)
+                frame_actions[frame, action.value] = successors[StateCode.encode(next_state)]
+                next_frames[frame, action.value] = StateCode.frame(next_state)
+
+        return frame_actions, next_frames
+
+# ========== Class-level tables (require the class to be defined) =============
+
+StateCode._StateCode__permutations = tuple(itertools.permutations(range(7)))
+StateCode._StateCode__position_ranks = {p: i for i, p in enumerate(StateCode._StateCode__permutations)}
+StateCode._StateCode__frame_rotations = StateCode._create_frame_rotations()
+StateCode.POSITION_MOVES, StateCode.ORIENTATION_MOVES = StateCode._create_move_tables()
+StateCode.FRAME_ACTIONS, StateCode.NEXT_FRAMES = StateCode._create_frame_actions()
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    import random
+
+    # Actions on states and codes (mapped to the canonical frame, tracking the frame) result in the same codes
+    state = State()
+    for _ in range(20):
+        state = state.next_state(random.choice(list(Action)))
+    code, frame = StateCode.encode(state), StateCode.frame(state)
+    for _ in range(20):
+        action = random.choice(list(Action))
+        state = state.next_state(action)
+        code = StateCode.next_code(code, int(StateCode.FRAME_ACTIONS[frame, action.value]))
+        frame = int(StateCode.NEXT_FRAMES[frame, action.value])
+        assert (code == StateCode.encode(state)) and (frame == StateCode.frame(state))
+    print(f'Code {code:_} of {StateCode.NUMBER_CODES:_}, frame {frame}: {StateCode.decode(code).positions}')
@@ -0,0 +1,302 @@
+"""
+Batch encoding of Pocket cube states as input of neural networks.
+
+State.one_hot_encoding() encodes each of the 8 corner cubies as one-hot
+vector of 24 numbers, i.e., 192 floats (768 bytes) per state. The same
+information is given by 8 indices, one per cubie c in [0, 7]:
+
+    index[c] = 3 * <position of cubie c> + <orientation of cubie c>
+
+with the value 1 of the one-hot encoding at [c, index[c]]. A network's first
+dense layer applied to the one-hot encoding therefore equals the sum of 8
+rows of its weight matrix (refer to class FactorizedInput), i.e., models can
+be fed indices and perform embedding lookups instead of a dense layer.
+
+The BatchEncoder produces all formats from the same (N, 8) index array:
+- 'one_hot': numpy.ndarray of shape (N, 8, 24) and dtype float32 (same as State.one_hot_encode_states())
+- 'indices': numpy.ndarray of shape (N, 8) and dtype uint8 (8 bytes per state)
+- 'packed': numpy.ndarray of shape (N,) and dtype uint64 (5 bits per index, 40 bits per state)
+
+An action moves 4 cubies only. The IncrementalEncoder updates the indices and
+one-hot encodings of states in place by a table lookup per action, i.e.,
+changes 4 rows instead of encoding the next state anew.
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+import numpy as np
+from PCubeAction import Action
+from PCubeState import State
+
+class BatchEncoder:
+
+    # Encoding formats
+    FORMATS = ('one_hot', 'indices', 'packed')
+
+    # Number of cubies and values per index
+    NUMBER_CUBIES = 8
+    NUMBER_VALUES = 24
+    PACKED_BITS = 5
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, encoding='one_hot'):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        encoding : string, optional
+            Format returned by encode(): 'one_hot', 'indices', or 'packed'. (Default: 'one_hot')
+
+        Returns
+        -------
+        None.
+
+        """
+        assert encoding in BatchEncoder.FORMATS
+        self.encoding = encoding
+
+    # ========== Encode =======================================================
+
+    def encode(self, states):
+        """
+        Encode states in the format of the encoder.
+
+        Parameters
+        ----------
+        states : list(State)
+            States to encode.
+
+        Returns
+        -------
+        numpy.ndarray
+            Encoded states (refer to the module documentation for shapes and types).
+
+        """
+        indices = BatchEncoder.indices(states)
+        if self.encoding == 'indices':
+            return indices
+        elif self.encoding == 'packed':
+            return BatchEncoder.pack(indices)
+        return BatchEncoder.one_hot(indices)
+
+    # -------------------------------------------------------------------------
+
+    def indices(states):
+        """
+        Get the indices 3 * position + orientation of each cubie.
+
+        Parameters
+        ----------
+        states : list(State)
+            States to encode.
+
+        Returns
+        -------
+        numpy.ndarray of shape (N, 8) and dtype uint8
+            Index of each state and cubie.
+
+        """
+        positions = np.array([state.positions for state in states], dtype=np.uint8).reshape(-1, BatchEncoder.NUMBER_CUBIES)
+        orientations = np.array([state.orientations for state in states], dtype=np.uint8).reshape(-1, BatchEncoder.NUMBER_CUBIES)
+        return BatchEncoder.indices_from_arrays(positions, orientations)
+
+    # -------------------------------------------------------------------------
+
+    def indices_from_arrays(positions, orientations):
+        """
+        Get the indices of states given as arrays of shape (N, 8) (e.g., of vectorized environments).
+        """
+        cubie_positions = np.argsort(positions, axis=1).astype(np.uint8)
+        cubie_orientations = np.take_along_axis(orientations, cubie_positions, axis=1)
+        return (3 * cubie_positions + cubie_orientations).astype(np.uint8)
+
+    # ========== Convert formats ==============================================
+
+    def one_hot(indices):
+        """
+        Get the one-hot encoding (N, 8, 24) of float32 from indices (N, 8).
+        """
+        return BatchEncoder.__identity[indices]
+
+    # -------------------------------------------------------------------------
+
+    def pack(indices):
+        """
+        Pack indices (N, 8) into one uint64 per state (5 bits per index).
+        """
+        packed = np.zeros(len(indices), dtype=np.uint64)
+        for cubie in range(BatchEncoder.NUMBER_CUBIES):
+            packed |= indices[:, cubie].astype(np.uint64) << np.uint64(BatchEncoder.PACKED_BITS * cubie)
+        return packed
+
+    # -------------------------------------------------------------------------
+
+    def unpack(packed):
+        """
+        Get the indices (N, 8) of uint8 from packed states.
+        """
+        shifts = np.arange(BatchEncoder.NUMBER_CUBIES, dtype=np.uint64) * np.uint64(BatchEncoder.PACKED_BITS)
+        mask = np.uint64((1 << BatchEncoder.PACKED_BITS) - 1)
+        return ((np.asarray(packed, dtype=np.uint64)[:, None] >> shifts) & mask).astype(np.uint8)
+
+    # -------------------------------------------------------------------------
+
+    def to_states(indices):
+        """
+        Get the states of indices (N, 8).
+        """
+        states = []
+        for row in np.asarray(indices):
+            positions, orientations = [0] * 8, [0] * 8
+            for cubie, index in enumerate(row.tolist()):
+                position, orientation = divmod(index, 3)
+                positions[position], orientations[position] = cubie, orientation
+            states.append(State(tuple(positions), tuple(orientations)))
+        return states
+
+# -----------------------------------------------------------------------------
+# Incremental encoder
+# -----------------------------------------------------------------------------
+
+class IncrementalEncoder:
+
+    # ========== Update single state ==========================================
+
+    def update(one_hot, indices, action):
+        """
+        Apply an action to the encoding of a state in place.
+
+        Parameters
+        ----------
+        one_hot : numpy.ndarray of shape (8, 24)
+            One-hot encoding of the state (e.g., State.one_hot_encoding()).
+        indices : numpy.ndarray of shape (8,)
+            Indices of the state (refer to BatchEncoder.indices()).
+        action : Action
+            Action applied to the state.
+
+        Returns
+        -------
+        None.
+
+        """
+        new_indices = IncrementalEncoder.INDEX_MOVES[action.value][indices]
+        for cubie in IncrementalEncoder.__moved_cubies(indices, action.value):
+            one_hot[cubie, indices[cubie]] = 0
+            one_hot[cubie, new_indices[cubie]] = 1
+        indices[:] = new_indices
+
+    # -------------------------------------------------------------------------
+
+    def __moved_cubies(indices, action):
+        """
+        Get the cubies moved by an action (4 cubies).
+        """
+        return np.flatnonzero(IncrementalEncoder.MOVED_INDICES[action][indices])
+
+    # ========== Update batch =================================================
+
+    def update_batch(one_hot, indices, actions):
+        """
+        Apply one action to each state of a batch of encodings in place.
+
+        Parameters
+        ----------
+        one_hot : numpy.ndarray of shape (N, 8, 24)
+            One-hot encodings (e.g., BatchEncoder.one_hot()).
+        indices : numpy.ndarray of shape (N, 8)
+            Indices of the states.
+        actions : numpy.ndarray of shape (N,)
+            Action values.
+
+        Returns
+        -------
+        None.
+
+        """
+        actions = np.asarray(actions)
+        states, cubies = np.nonzero(IncrementalEncoder.MOVED_INDICES[actions[:, None], indices])
+        old_indices = indices[states, cubies]
+        new_indices = IncrementalEncoder.INDEX_MOVES[actions[states], old_indices]
+        one_hot[states, cubies, old_indices] = 0
+        one_hot[states, cubies, new_indices] = 1
+        indices[states, cubies] = new_indices
+
+    # ========== Create tables ================================================
+
+    def _create_index_moves():
+        """
+        Get the index of a cubie after an action for each action and index.
+
+        Returns
+        -------
+        numpy.ndarray of shape (12, 24) and dtype uint8
+            New index 3 * position + orientation for each action value and index.
+
+        """
+        index_moves = np.zeros((len(Action), BatchEncoder.NUMBER_VALUES), dtype=np.uint8)
+        for action in Action:
+            for index in range(BatchEncoder.NUMBER_VALUES):
+                position, orientation = divmod(index, 3)
+                orientations = [0] * 8
+                orientations[position] = orientation
+                state = State(tuple(range(8)), tuple(orientations)).next_state(action)
+                new_position = state.positions.index(position)
+                index_moves[action.value, index] = 3 * new_position + state.orientations[new_position]
+        return index_moves
+
+# ========== Class-level tables ===============================================
+
+BatchEncoder._BatchEncoder__identity = np.eye(BatchEncoder.NUMBER_VALUES, dtype=np.float32)
+IncrementalEncoder.INDEX_MOVES = IncrementalEncoder._create_index_moves()
+IncrementalEncoder.MOVED_INDICES = IncrementalEncoder.INDEX_MOVES != np.arange(BatchEncoder.NUMBER_VALUES, dtype=np.uint8)
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    import time
+    import random
+
+    states = [State()]
+    for _ in range(1_000):
+        states.append(states[-1].next_state(random.choice(list(Action))))
+
+    indices = BatchEncoder.indices(states)
+    is_equal = (BatchEncoder.one_hot(indices) == State.one_hot_encode_states(states)).all()
+    is_lossless = (BatchEncoder.unpack(BatchEncoder.pack(indices)) == indices).all()
+    is_decoded = all(a.positions == b.positions and a.orientations == b.orientations
+                     for a, b in zip(states, BatchEncoder.to_states(indices)))
+    print(f'One-hot equal to State: {is_equal}, packing lossless: {is_lossless}, decoding: {is_decoded}')
+    for encoding in BatchEncoder.FORMATS:
+        print(f'{encoding:<8}: {BatchEncoder(encoding).encode(states).nbytes / len(states):6.0f} bytes/state')
+
+    # Incremental updates along a sequence of actions (single state and batch)
+    one_hot, indices = State().one_hot_encoding(), BatchEncoder.indices([State()])[0]
+    batch_indices = BatchEncoder.indices(states)
+    batch_one_hot = BatchEncoder.one_hot(batch_indices)
+    for _ in range(20):
+        action = random.choice(list(Action))
+        IncrementalEncoder.update(one_hot, indices, action)
+        actions = np.random.randint(0, len(Action), len(states))
+        IncrementalEncoder.update_batch(batch_one_hot, batch_indices, actions)
+        states = [state.next_state(Action(int(a))) for state, a in zip(states, actions)]
+    print(f'Incremental batch equal to State: {(batch_one_hot == State.one_hot_encode_states(states)).all()}')
+
+    # Time of encoding anew vs. incremental updates (encoding only, next states computed before)
+    actions = np.random.randint(0, len(Action), len(states))
+    next_states = [state.next_state(Action(int(a))) for state, a in zip(states, actions)]
+    start_time = time.perf_counter()
+    State.one_hot_encode_states(next_states)
+    anew_s = time.perf_counter() - start_time
+    start_time = time.perf_counter()
+    IncrementalEncoder.update_batch(batch_one_hot, batch_indices, actions)
+    incremental_s = time.perf_counter() - start_time
+    print(f'Next states encoded anew: {1e6 * anew_s / len(states):.2f} us/state, incremental: {1e6 * incremental_s / len(states):.3f} us/state')
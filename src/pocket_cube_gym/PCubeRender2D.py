@@ -1,5 +1,5 @@
 """
-2D rendering of Pocket cubes for OpenAI gym.
+2D rendering of Pocket cubes (and Rubik's cubes) for OpenAI gym.
 
 The 'match' syntax in chooseColor requires Python 3.10 or higher.
 
@@ -9,7 +9,7 @@ by the command 'pip install pygame'.
 @authors: Finn Lanz (initial), Marc Hensel (refactoring, maintenance)
 @contact: http://www.haw-hamburg.de/marc-hensel
 @copyright: 2023
-@version: 2023.08.21
+@version: 2026.10.18
 @license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
 """
 import os
@@ -17,23 +17,24 @@ import pygame
 import ctypes
 from ctypes import wintypes
 from time import sleep
-from PCubeState import State
 
 class Render2D:
     
     # ========== Constructor ==================================================
 
-    def __init__(self, env, fps):
+    def __init__(self, env, fps, cube_size=2):
         """
         Constructor.
 
         Parameters
         ----------
-        env : PocketCubeEnv
+        env : PocketCubeEnv or RubikCubeEnv
             Gym environment containing the cube to be rendered.
         fps : float
             Speed of the rendering in frames per seconds.
             Determines how long a state will shown before proceeding.
+        cube_size : int, optional
+            Number of facelets per row of a face (2: Pocket cube, 3: Rubik's cube). (Default: 2)
 
         Returns
         -------
@@ -41,15 +42,17 @@ class Render2D:
         
         """
         assert isinstance(fps, float) and (fps > 0.0)
+        assert cube_size in [2, 3]
         
         # Set parent environment and render speed
         self.__env = env
         self.__fps = fps
         
-        # Cube and window dimensions
-        self.__facelet_size = 60
-        self.__width = 9 * self.__facelet_size
-        self.__height = 7 * self.__facelet_size
+        # Cube and window dimensions (net of 4 x 3 faces plus margin of half a facelet)
+        self.__cube_size = cube_size
+        self.__facelet_size = 120 // cube_size
+        self.__width = (4 * cube_size + 1) * self.__facelet_size
+        self.__height = (3 * cube_size + 1) * self.__facelet_size
         self.__x_center = self.__width / 2
         self.__y_center = self.__height / 2
 
@@ -58,7 +61,7 @@ class Render2D:
         pygame.display.init()        
         
         # Set window properties and get canvas
-        pygame.display.set_caption('Pocket cube gym')
+        pygame.display.set_caption('Pocket cube gym' if cube_size == 2 else "Rubik's cube gym")
         self.font = pygame.font.SysFont('Consolas', 24)
         self.screen = pygame.display.set_mode((self.__width, self.__height), pygame.HIDDEN)
         self.canvas = pygame.Surface((self.__width, self.__height))
@@ -178,7 +181,7 @@ class Render2D:
         Parameters
         ----------
         state : State
-            State to visualize.
+            State (Pocket cube or Rubik's cube) to visualize.
             By default (None) the observation space of self._env is used.
     
         Returns
@@ -186,7 +189,7 @@ class Render2D:
         None.
         
         """
-        assert isinstance(state, State)
+        assert hasattr(state, 'get_plane_representation')
 
         # Show window and draw cube
         self.show_window(True)
@@ -248,9 +251,10 @@ class Render2D:
         image_actions = self.font.render(f'Moves     : {self.__env.number_actions}', True, text_color)
         image_scrambles = self.font.render(f'Scrambles : {self.__env.number_scrambles}', True, text_color)
         
-        self.screen.blit(image_last_action, (self.__x_center + self.__facelet_size , 40))
-        self.screen.blit(image_actions, (self.__x_center + self.__facelet_size , 65))
-        self.screen.blit(image_scrambles, (self.__x_center + self.__facelet_size , 90))
+        x0 = self.__x_center + self.__cube_size * self.__facelet_size / 2
+        self.screen.blit(image_last_action, (x0, 40))
+        self.screen.blit(image_actions, (x0, 65))
+        self.screen.blit(image_scrambles, (x0, 90))
     
     # -------------------------------------------------------------------------
 
@@ -275,32 +279,34 @@ class Render2D:
         plane_representation = [plane_representation[i] for i in order]
 
         # Draw faces on top (U, 'up') and bottom (D, 'down')
+        n = self.__cube_size
+        assert len(plane_representation[0]) == n * n
         frame_color = Render2D.__colors['black']
-        for row in range(2):
-            for col in range(2):
+        for row in range(n):
+            for col in range(n):
                 # Up
-                color = Render2D._char2color(plane_representation[0][2 * row + col])
-                x0 = self.__x_center - ((2 - col) * self.__facelet_size)
-                y0 = self.__y_center - ((3 - row) * self.__facelet_size)
+                color = Render2D._char2color(plane_representation[0][n * row + col])
+                x0 = self.__x_center - ((n - col) * self.__facelet_size)
+                y0 = self.__y_center - ((1.5 * n - row) * self.__facelet_size)
                 rectangle = pygame.Rect(x0, y0, self.__facelet_size + 1, self.__facelet_size + 1)
                 pygame.draw.rect(self.canvas, color, rectangle)             # Filled square
                 pygame.draw.rect(self.canvas, frame_color, rectangle, 1)    # Black frame
                 
                 # Down
-                color = Render2D._char2color(plane_representation[5][2 * row + col])
-                x0 = self.__x_center - ((2 - col) * self.__facelet_size)
-                y0 = self.__y_center + ((1 + row) * self.__facelet_size)
+                color = Render2D._char2color(plane_representation[5][n * row + col])
+                x0 = self.__x_center - ((n - col) * self.__facelet_size)
+                y0 = self.__y_center + ((0.5 * n + row) * self.__facelet_size)
                 rectangle = pygame.Rect(x0, y0, self.__facelet_size + 1, self.__facelet_size + 1)
                 pygame.draw.rect(self.canvas, color, rectangle)
                 pygame.draw.rect(self.canvas, frame_color, rectangle, 1)
         
         # Draw 4 faces in vertical center from left to right
         for face_idx in range(4):
-            for row in range(2):
-                for col in range(2):
-                    color = Render2D._char2color(plane_representation[face_idx + 1][2 * row + col])
-                    x0 = self.__x_center - ((4 - col) * self.__facelet_size) + (2 * face_idx * self.__facelet_size)
-                    y0 = self.__y_center - ((1 - row) * self.__facelet_size)
+            for row in range(n):
+                for col in range(n):
+                    color = Render2D._char2color(plane_representation[face_idx + 1][n * row + col])
+                    x0 = self.__x_center - ((2 * n - col) * self.__facelet_size) + (n * face_idx * self.__facelet_size)
+                    y0 = self.__y_center - ((0.5 * n - row) * self.__facelet_size)
                     rectangle = pygame.Rect(x0, y0, self.__facelet_size + 1, self.__facelet_size + 1)
                     pygame.draw.rect(self.canvas, color, rectangle)
                     pygame.draw.rect(self.canvas, frame_color, rectangle, 1)
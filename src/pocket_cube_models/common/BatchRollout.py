@@ -0,0 +1,273 @@
+"""
+Batched rollouts of policies solving many Pocket cubes in lockstep.
+
+Applying a policy state by state (e.g., SampleAgent.apply_policy() or
+PolicyEvaluation.evaluate_policy()) costs one Python call per action and
+cube. The rollout engine instead advances a batch of cubes at once:
+
+1. Ask the policy for the best actions of all active cubes in one call.
+2. Apply the actions to all cubes by table lookups (refer to StateCode.next_codes()).
+3. Retire cubes that are solved, have no known action, or reached the
+   maximum number of actions.
+
+Cubes are represented by their codes and policies by batch functions
+mapping codes (N,) to action values (N,) in the canonical frame of the
+codes (refer to class StateCode). Values >= 12 (e.g., NO_ACTION) denote
+unknown states. Adapters create batch functions from
+- best action tables (refer to class BestActionTable),
+- quality tables indexed by code (e.g., RetrogradeQ.Q or ActorLearner.Q),
+- distance tables (optimal actions, refer to class DistanceTable), and
+- functions of states (batched, e.g., learned models, or single states).
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add Pocket cube env to path
+import os
+import sys
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'pocket_cube_gym'))
+
+# Other imports
+import time
+import numpy as np
+from PCubeState import State
+from PCubeCode import StateCode
+
+class BatchRollout:
+
+    # Action value of unknown states (same as BestActionTable.NO_ACTION)
+    NO_ACTION = 0xF
+
+    # Frame of decoded (canonical) states
+    CANONICAL_FRAME = StateCode.frame(State())
+
+    # Actions allowed after each action when scrambling codes: all but the inverse (e.g., r after R)
+    # and the action equal to it in the canonical frame (e.g., l after R, since L equals R on codes),
+    # and after two equal actions (e.g., R L) only actions turning another axis (R R R equals r)
+    _SCRAMBLE_ACTIONS = np.array([[b for b in range(12) if ((b % 6) // 2 != (a % 6) // 2) or (b // 6 == a // 6)]
+                                  for a in range(12)])
+    _SCRAMBLE_AXIS_ACTIONS = np.array([[b for b in range(12) if (b % 6) // 2 != (a % 6) // 2] for a in range(12)])
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, best_actions, max_actions=30, batch_size=10_000):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        best_actions : function
+            Batch policy mapping codes (N,) to action values (N,) in the canonical frame.
+        max_actions : int, optional
+            Maximum number of actions to solve a cube. (Default: 30)
+        batch_size : int, optional
+            Number of cubes advanced in lockstep. (Default: 10_000)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.best_actions = best_actions
+        self.max_actions = max_actions
+        self.batch_size = batch_size
+
+        # Statistics of the last run
+        self.number_decisions = 0
+        self.call_latencies_ns = []
+        self.elapsed_s = 0.0
+
+    # ========== Run ==========================================================
+
+    def run(self, codes):
+        """
+        Apply the policy to all cubes until solved, unknown, or the maximum number of actions.
+
+        Parameters
+        ----------
+        codes : numpy.ndarray of shape (N,)
+            Codes of the initial states.
+
+        Returns
+        -------
+        numpy.ndarray of shape (N,) and dtype int16
+            Number of actions solving each cube, or -1 if not solved.
+
+        """
+        codes = np.asarray(codes, dtype=np.int32)
+        lengths = np.full(len(codes), -1, dtype=np.int16)
+        self.number_decisions = 0
+        self.call_latencies_ns = []
+        start_time = time.perf_counter()
+
+        for start in range(0, len(codes), self.batch_size):
+            indices = np.arange(start, min(start + self.batch_size, len(codes)))
+            current = codes[indices]
+            for step in range(self.max_actions + 1):
+                # Retire solved cubes
+                is_solved = current == StateCode.SOLVED_CODE
+                lengths[indices[is_solved]] = step
+                indices, current = indices[~is_solved], current[~is_solved]
+                if (len(current) == 0) or (step == self.max_actions):
+                    break
+
+                # Ask the policy for all actions at once and retire unknown states
+                start_ns = time.perf_counter_ns()
+                actions = np.asarray(self.best_actions(current))
+                self.call_latencies_ns.append(time.perf_counter_ns() - start_ns)
+                self.number_decisions += len(current)
+                is_known = actions < 12
+                if not is_known.all():
+                    indices, current, actions = indices[is_known], current[is_known], actions[is_known]
+                current = StateCode.next_codes(current, actions).astype(np.int32)
+
+        self.elapsed_s = time.perf_counter() - start_time
+        return lengths
+
+    # -------------------------------------------------------------------------
+
+    def decisions_per_s(self):
+        """
+        Get the throughput of the last run (decisions per second including applying actions).
+        """
+        return self.number_decisions / self.elapsed_s if self.elapsed_s > 0 else float('inf')
+
+    # ========== Test sets ====================================================
+
+    def scrambled_codes(number_scrambles, number_cubes, seed=None):
+        """
+        Get codes of cubes scrambled by random actions (no actions cancelling or shortening on codes).
+
+        Parameters
+        ----------
+        number_scrambles : int
+            Number of random actions.
+        number_cubes : int
+            Number of cubes.
+        seed : int, optional
+            Seed of the random number generator. (Default: None)
+
+        Returns
+        -------
+        numpy.ndarray of shape (number_cubes,) and dtype int32
+            Codes of the scrambled cubes.
+
+        """
+        rng = np.random.default_rng(seed)
+        codes = np.full(number_cubes, StateCode.SOLVED_CODE, dtype=np.int32)
+        actions = rng.integers(0, 12, number_cubes)
+        is_double = np.zeros(number_cubes, dtype=bool)
+        for step in range(number_scrambles):
+            if step > 0:
+                # Random action except the inverses of the prior action in code space (and a third equal action)
+                next_actions = BatchRollout._SCRAMBLE_ACTIONS[actions, rng.integers(0, 10, number_cubes)]
+                axis_actions = BatchRollout._SCRAMBLE_AXIS_ACTIONS[actions, rng.integers(0, 8, number_cubes)]
+                next_actions = np.where(is_double, axis_actions, next_actions)
+                is_double = (next_actions % 6) // 2 == (actions % 6) // 2
+                actions = next_actions
+            codes = StateCode.next_codes(codes, actions).astype(np.int32)
+        return codes
+
+    # -------------------------------------------------------------------------
+
+    def random_codes(number_cubes, seed=None):
+        """
+        Get codes of uniformly random states.
+        """
+        return np.random.default_rng(seed).integers(0, StateCode.NUMBER_CODES, number_cubes).astype(np.int32)
+
+    # ========== Policy adapters ==============================================
+
+    def from_table(table):
+        """
+        Get the batch policy of a best action table (refer to class BestActionTable).
+        """
+        return table.code_actions
+
+    # -------------------------------------------------------------------------
+
+    def from_q_table(Q):
+        """
+        Get the batch policy of a quality table indexed by code and action (rows with maximum <= 0 are unknown).
+        """
+        def best_actions(codes):
+            q = Q[codes]
+            return np.where(q.max(axis=1) > 0, q.argmax(axis=1), BatchRollout.NO_ACTION)
+        return best_actions
+
+    # -------------------------------------------------------------------------
+
+    def from_distances(distances):
+        """
+        Get the optimal batch policy of the distances of all codes (refer to class DistanceTable).
+        """
+        return lambda codes: np.argmin(distances[StateCode.successor_codes(codes)], axis=1)
+
+    # -------------------------------------------------------------------------
+
+    def from_states(best_actions):
+        """
+        Get the batch policy of a function of a batch of states (e.g., a learned model).
+
+        Parameters
+        ----------
+        best_actions : function
+            Function mapping list(State) to an iterable of Action (or None if unknown).
+
+        Returns
+        -------
+        function
+            Batch policy of codes.
+
+        """
+        frame_actions = StateCode.FRAME_ACTIONS[BatchRollout.CANONICAL_FRAME]
+
+        def code_actions(codes):
+            states = [StateCode.decode(code) for code in codes.tolist()]
+            return np.array([frame_actions[action.value] if action is not None else BatchRollout.NO_ACTION
+                             for action in best_actions(states)], dtype=np.uint8)
+        return code_actions
+
+    # -------------------------------------------------------------------------
+
+    def from_state_policy(best_action):
+        """
+        Get the batch policy of a function of a single state (e.g., Policy.best_action).
+
+        Note that states are decoded in the canonical orientation of the cube as
+        a whole. Export orientation dependent tables (e.g., the sample policy)
+        to a BestActionTable instead (refer to BestActionTable.from_policy()).
+        """
+        return BatchRollout.from_states(lambda states: [best_action(state) for state in states])
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'optimal'))
+    from DistanceTable import DistanceTable
+    from RetrogradeQ import RetrogradeQ
+    from BestActionTable import BestActionTable
+
+    distances = DistanceTable(verbose=False).distances
+    policies = [('Best action table', BatchRollout.from_table(BestActionTable.from_distances(distances))),
+                ('Retrograde Q', BatchRollout.from_q_table(RetrogradeQ(verbose=False).Q)),
+                ('Distances', BatchRollout.from_distances(distances)),
+                ('Random', lambda codes: np.random.randint(0, 12, len(codes)))]
+
+    # Evaluate each policy on one million cubes per test set
+    for title, codes in (('6 scrambles', BatchRollout.scrambled_codes(6, 1_000_000, seed=0)),
+                         ('Uniformly random states', BatchRollout.random_codes(1_000_000, seed=0))):
+        print(f'\n{title}')
+        for name, best_actions in policies:
+            rollout = BatchRollout(best_actions)
+            lengths = rollout.run(codes)
+            is_solved = lengths >= 0
+            is_optimal = lengths == distances[codes]
+            print(f'{name:<18}: {100 * is_solved.mean():5.1f} % solved, {100 * is_optimal.mean():5.1f} % optimal, '
+                  f'{rollout.elapsed_s:5.2f} s ({rollout.decisions_per_s():>12_.0f} decisions/s)')
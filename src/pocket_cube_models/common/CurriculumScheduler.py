@@ -0,0 +1,214 @@
+"""
+Curriculum of scramble depths controlled by the measured solve rates.
+
+Training a policy for N scrambles requires that the policy already solves
+cubes scrambled by (N - 1) actions. Instead of a fixed number of episodes per
+depth, the scheduler trains in rounds:
+
+1. Measure the solve rate of each active depth on freshly scrambled cubes.
+2. Mark depths as mastered when their solve rate reaches the mastery rate.
+   Mastered depths receive no further episodes. Depths becoming active by
+   this are measured in the same round.
+3. Distribute the episodes of the round over the active depths in proportion
+   to depth * (1 - solve rate), i.e., towards the weakest depths. Depths
+   without a measured solve rate receive min_episodes only.
+
+Active depths are the lowest depth not mastered yet and, optionally, further
+depths ahead of it (lookahead). Training stops when all depths are mastered
+or the maximum number of rounds is reached.
+
+Usage:
+    scheduler = CurriculumScheduler(max_depth=4)
+    scheduler.run(train=agent.train_policy, evaluate=agent.solve_rate)
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+class CurriculumScheduler:
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, max_depth, episodes_per_round=5_000, mastery_rate=0.98, lookahead=1,
+                 min_episodes=100, evaluation_size=200):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        max_depth : int
+            Maximum number of scrambles to train for.
+        episodes_per_round : int, optional
+            Number of training episodes per round (over all depths). (Default: 5_000)
+        mastery_rate : float, optional
+            Solve rate in [0, 1] at which a depth is mastered. (Default: 0.98)
+        lookahead : int, optional
+            Number of depths trained beyond the lowest depth not mastered. (Default: 1)
+        min_episodes : int, optional
+            Minimum number of episodes of an active depth per round. (Default: 100)
+        evaluation_size : int, optional
+            Number of cubes to measure the solve rate of a depth. (Default: 200)
+
+        Returns
+        -------
+        None.
+
+        """
+        assert max_depth >= 1
+        self.max_depth = max_depth
+        self.episodes_per_round = episodes_per_round
+        self.mastery_rate = mastery_rate
+        self.lookahead = lookahead
+        self.min_episodes = min_episodes
+        self.evaluation_size = evaluation_size
+        self.reset()
+
+    # -------------------------------------------------------------------------
+
+    def reset(self):
+        """
+        Forget solve rates, mastered depths, and history.
+        """
+        self.solve_rates = {}
+        self.mastered = set()
+        self.episodes = {depth: 0 for depth in range(1, self.max_depth + 1)}
+        self.history = []
+
+    # ========== Schedule =====================================================
+
+    def active_depths(self):
+        """
+        Get the depths to train in the next round (empty if all depths are mastered).
+        """
+        open_depths = [depth for depth in range(1, self.max_depth + 1) if depth not in self.mastered]
+        if len(open_depths) == 0:
+            return []
+        return [depth for depth in open_depths if depth <= open_depths[0] + self.lookahead]
+
+    # -------------------------------------------------------------------------
+
+    def update(self, solve_rates):
+        """
+        Store measured solve rates and mark mastered depths.
+
+        Parameters
+        ----------
+        solve_rates : dict
+            Solve rate in [0, 1] for each measured depth.
+
+        Returns
+        -------
+        None.
+
+        """
+        self.solve_rates.update(solve_rates)
+        for depth, rate in solve_rates.items():
+            if rate >= self.mastery_rate:
+                self.mastered.add(depth)
+
+    # -------------------------------------------------------------------------
+
+    def allocate(self):
+        """
+        Distribute the episodes of a round over the active depths.
+
+        Returns
+        -------
+        dict
+            Number of episodes for each active depth.
+
+        """
+        depths = self.active_depths()
+        if len(depths) == 0:
+            return {}
+
+        # Depths not measured yet (e.g., unlocked without evaluation)
+        allocation = {depth: self.min_episodes for depth in depths if depth not in self.solve_rates}
+        weights = {depth: depth * (1.0 - self.solve_rates[depth]) for depth in depths if depth in self.solve_rates}
+        total_weight = sum(weights.values())
+        remaining = max(0, self.episodes_per_round - sum(allocation.values()))
+        for depth, weight in weights.items():
+            share = remaining * weight / total_weight if total_weight > 0 else 0
+            allocation[depth] = max(self.min_episodes, round(share))
+        return {depth: allocation[depth] for depth in depths}
+
+    # ========== Run curriculum ===============================================
+
+    def run(self, train, evaluate, max_rounds=100, verbose=True):
+        """
+        Train in rounds until all depths are mastered.
+
+        Parameters
+        ----------
+        train : function
+            Function (depth, number_episodes) training the policy (e.g., SampleAgent.train_policy).
+        evaluate : function
+            Function (depth, number_cubes) returning the solve rate in [0, 1] (e.g., SampleAgent.solve_rate).
+        max_rounds : int, optional
+            Maximum number of training rounds. (Default: 100)
+        verbose : bool, optional
+            Print solve rates and episodes of each round. (Default: True)
+
+        Returns
+        -------
+        bool
+            True if all depths are mastered, else False.
+
+        """
+        for current_round in range(1, max_rounds + 1):
+            # Measure solve rates of the active depths (including depths unlocked by mastering others)
+            depths = self.active_depths()
+            self.update({depth: evaluate(depth, self.evaluation_size) for depth in depths})
+            unlocked = [depth for depth in self.active_depths() if depth not in depths]
+            while len(unlocked) > 0:
+                self.update({depth: evaluate(depth, self.evaluation_size) for depth in unlocked})
+                depths += unlocked
+                unlocked = [depth for depth in self.active_depths() if depth not in depths]
+            allocation = self.allocate()
+            self.history.append({'round': current_round,
+                                 'solve_rates': {depth: self.solve_rates[depth] for depth in depths},
+                                 'episodes': allocation})
+            if verbose:
+                rates = ', '.join(f'{depth}: {100 * self.solve_rates[depth]:.1f} %' for depth in depths)
+                print(f'Round {current_round}: solve rates {rates} -> episodes {allocation}', flush=True)
+            if len(allocation) == 0:
+                return True
+
+            # Train the active depths
+            for depth, number_episodes in allocation.items():
+                train(depth, number_episodes)
+                self.episodes[depth] += number_episodes
+
+        return len(self.active_depths()) == 0
+
+    # -------------------------------------------------------------------------
+
+    def total_episodes(self):
+        """
+        Get the number of episodes trained over all depths.
+        """
+        return sum(self.episodes.values())
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    import random
+
+    # Simulated policy: solve rate of a depth grows with its episodes, if the depth below is solved
+    knowledge = {}
+
+    def train(depth, number_episodes):
+        knowledge[depth] = knowledge.get(depth, 0) + number_episodes * (knowledge.get(depth - 1, 10_000 * (depth == 1)) / 10_000)
+
+    def evaluate(depth, number_cubes):
+        rate = min(1.0, knowledge.get(depth, 0) / (2_000 * depth ** 2))
+        return sum(random.random() < rate for _ in range(number_cubes)) / number_cubes
+
+    scheduler = CurriculumScheduler(max_depth=4)
+    is_mastered = scheduler.run(train, evaluate)
+    print(f'Mastered: {is_mastered}, episodes per depth: {scheduler.episodes} (total {scheduler.total_episodes():_})')
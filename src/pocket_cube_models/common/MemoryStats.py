@@ -0,0 +1,191 @@
+"""
+Memory accounting of large data structures.
+
+Large structures (policy tables, solver tables, replay buffers, caches)
+provide a method memory_stats() returning a dictionary with (at least) the
+key 'bytes'. Optional keys are:
+
+- 'entries': Number of entries held in memory
+- 'max_bytes', 'max_entries': Configured caps (None if unlimited)
+- 'spilled_entries', 'spilled_bytes': Entries moved to disk
+- 'evicted_entries': Entries dropped to stay below the cap
+- 'shared': True for memory-mapped files (pages shared between processes)
+
+The structures are registered at a MemoryStats object, which collects and
+reports their statistics together with the memory of the process.
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+import os
+import sys
+import itertools
+
+class MemoryStats:
+
+    # ========== Constructor ==================================================
+
+    def __init__(self):
+        """
+        Constructor.
+
+        Returns
+        -------
+        None.
+
+        """
+        self._sources = {}
+
+    # ========== Register structures ==========================================
+
+    def register(self, name, source):
+        """
+        Register a structure providing memory_stats().
+
+        Parameters
+        ----------
+        name : string
+            Name of the structure in reports.
+        source : object
+            Structure with method memory_stats() returning a dictionary.
+
+        Returns
+        -------
+        None.
+
+        """
+        assert hasattr(source, 'memory_stats')
+        self._sources[name] = source
+
+    def unregister(self, name):
+        """
+        Remove a registered structure.
+        """
+        self._sources.pop(name, None)
+
+    # ========== Collect ======================================================
+
+    def collect(self):
+        """
+        Get the statistics of all registered structures.
+
+        Returns
+        -------
+        dict
+            Statistics (dictionary) for each registered name.
+
+        """
+        return {name: source.memory_stats() for name, source in self._sources.items()}
+
+    # -------------------------------------------------------------------------
+
+    def total_bytes(self, include_shared=False):
+        """
+        Get the sum of the memory of all registered structures.
+
+        Parameters
+        ----------
+        include_shared : bool, optional
+            Include memory-mapped structures? (Default: False)
+
+        Returns
+        -------
+        int
+            Memory in bytes.
+
+        """
+        return sum(stats['bytes'] for stats in self.collect().values()
+                   if include_shared or not stats.get('shared', False))
+
+    # -------------------------------------------------------------------------
+
+    def process_bytes():
+        """
+        Get the resident memory of the process (None if unknown on this platform).
+        """
+        try:
+            import psutil
+            return psutil.Process().memory_info().rss
+        except ImportError:
+            pass
+        try:
+            with open('/proc/self/statm') as file:
+                return int(file.read().split()[1]) * os.sysconf('SC_PAGE_SIZE')
+        except (OSError, ValueError, AttributeError):
+            return None
+
+    # ========== Report =======================================================
+
+    def report(self):
+        """
+        Print the statistics of all registered structures and the process.
+
+        Returns
+        -------
+        None.
+
+        """
+        print('Memory:')
+        for name, stats in self.collect().items():
+            details = ', '.join(f'{key} {value:_}' if type(value) is int else f'{key} {value}'
+                                for key, value in stats.items() if (key != 'bytes') and (value is not None))
+            print(f'  {name:<24}{MemoryStats.format_bytes(stats["bytes"]):>12}  {details}')
+        process_bytes = MemoryStats.process_bytes()
+        if process_bytes is not None:
+            print(f'  {"process (resident)":<24}{MemoryStats.format_bytes(process_bytes):>12}')
+
+    # -------------------------------------------------------------------------
+
+    def format_bytes(number_bytes):
+        """
+        Format a memory size with suitable unit.
+        """
+        for unit, scale in (('GiB', 2**30), ('MiB', 2**20), ('KiB', 2**10)):
+            if number_bytes >= scale:
+                return f'{number_bytes / scale:.1f} {unit}'
+        return f'{number_bytes} B'
+
+    # ========== Estimates ====================================================
+
+    def estimate_dict_bytes(table, number_samples=100):
+        """
+        Estimate the memory of a dictionary with tuple keys and numpy array values.
+
+        The size of the entries is extrapolated from the first number_samples
+        entries, so that the estimate is cheap for large tables. Elements of
+        the keys are not counted (small integers are shared objects).
+
+        Returns
+        -------
+        int
+            Estimated size in bytes.
+
+        """
+        size = sys.getsizeof(table)
+        if len(table) == 0:
+            return size
+        samples = list(itertools.islice(table.items(), number_samples))
+        entry_bytes = sum(sys.getsizeof(key) + sys.getsizeof(value) for key, value in samples)
+        return size + entry_bytes * len(table) // len(samples)
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    import numpy as np
+
+    class Table:
+        def __init__(self):
+            self.data = {(i, i + 1): np.zeros(12, dtype=int) for i in range(10_000)}
+
+        def memory_stats(self):
+            return {'bytes': MemoryStats.estimate_dict_bytes(self.data), 'entries': len(self.data)}
+
+    stats = MemoryStats()
+    stats.register('table', Table())
+    stats.report()
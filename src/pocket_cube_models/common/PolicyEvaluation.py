@@ -0,0 +1,326 @@
+"""
+Evaluation of policies, solvers, and learned models solving Pocket cubes.
+
+Agents are evaluated on the same test sets of states, either scrambled by a
+fixed number of random actions or uniformly random. Two kinds of agents are
+supported:
+
+- Policies choose one action per state (e.g., Policy.best_action() or a
+  learned model). They are applied until the cube is solved or a maximum
+  number of actions has been taken.
+- Solvers return a whole solution (list of actions) per state.
+- Batch policies choose the actions of many states in one call and are
+  applied to all states in lockstep (refer to class BatchRollout).
+
+Metrics of each agent and test set:
+- Solve rate and rate of optimal solutions
+- Average solution length and average excess over the optimal length
+  (solved states only; optimal lengths from class DistanceTable)
+- Decisions per second and latency percentiles of a decision (policies) or
+  of a solution (solvers)
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add Pocket cube env and optimal solver to path
+import os
+import sys
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'pocket_cube_gym'))
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'optimal'))
+
+# Other imports
+import time
+import random
+import numpy as np
+from PCubeAction import Action
+from PCubeState import State
+from PCubeCode import StateCode
+from DistanceTable import DistanceTable
+from BatchRollout import BatchRollout
+
+class PolicyEvaluation:
+
+    # Actions rotating the cube as a whole (color up, then horizontal rotation)
+    __face_up = ([], [Action.B, Action.f], [Action.b, Action.F], [Action.R, Action.l],
+                 [Action.r, Action.L], [Action.R, Action.R, Action.l, Action.l])
+    __horizontal = ([], [Action.D, Action.u], [Action.D, Action.D, Action.u, Action.u], [Action.d, Action.U])
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, distance_table=None, max_actions=30, seed=None):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        distance_table : DistanceTable, optional
+            Optimal solution lengths. (Default: None, i.e., open default table)
+        max_actions : int, optional
+            Maximum number of actions a policy may take to solve a cube. (Default: 30)
+        seed : int, optional
+            Seed of the random test set generation. (Default: None)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.distance_table = DistanceTable() if distance_table is None else distance_table
+        self.max_actions = max_actions
+        self.random = random.Random(seed)
+
+    # ========== Test sets ====================================================
+
+    def _random_orientation(self, state):
+        """
+        Rotate a state as a whole randomly (like PocketCubeEnv.reset()).
+        """
+        for action in self.random.choice(PolicyEvaluation.__face_up) + self.random.choice(PolicyEvaluation.__horizontal):
+            state = state.next_state(action)
+        return state
+
+    # -------------------------------------------------------------------------
+
+    def scrambled_states(self, number_scrambles, number_states):
+        """
+        Get states scrambled by random actions (like PocketCubeEnv.scramble()).
+
+        Parameters
+        ----------
+        number_scrambles : int
+            Number of random actions (without inverse action directly following an action).
+        number_states : int
+            Number of states.
+
+        Returns
+        -------
+        list(State)
+            Randomly oriented and scrambled states.
+
+        """
+        states = []
+        for _ in range(number_states):
+            state = self._random_orientation(State())
+            valid_actions = list(Action)
+            for _ in range(number_scrambles):
+                action = self.random.choice(valid_actions)
+                state = state.next_state(action)
+                valid_actions = list(Action)
+                valid_actions.remove(action.inverse_action())
+            states.append(state)
+        return states
+
+    # -------------------------------------------------------------------------
+
+    def random_states(self, number_states):
+        """
+        Get uniformly random (randomly oriented) states.
+        """
+        codes = [self.random.randrange(StateCode.NUMBER_CODES) for _ in range(number_states)]
+        return [self._random_orientation(StateCode.decode(code)) for code in codes]
+
+    # ========== Evaluate =====================================================
+
+    def evaluate_policy(self, name, best_action, states):
+        """
+        Evaluate a policy choosing one action per state.
+
+        Parameters
+        ----------
+        name : string
+            Name of the agent in reports.
+        best_action : function
+            Function returning an Action for a State (e.g., Policy.best_action).
+        states : list(State)
+            Test set.
+
+        Returns
+        -------
+        dict
+            Metrics (refer to _metrics()).
+
+        """
+        lengths, latencies_ns = [], []
+        for state in states:
+            number_actions = 0
+            while (number_actions < self.max_actions) and not state.is_cube_solved():
+                start_ns = time.perf_counter_ns()
+                action = best_action(state)
+                latencies_ns.append(time.perf_counter_ns() - start_ns)
+                state = state.next_state(action)
+                number_actions += 1
+            lengths.append(number_actions if state.is_cube_solved() else None)
+        return self._metrics(name, states, lengths, latencies_ns, 'decision')
+
+    # -------------------------------------------------------------------------
+
+    def evaluate_solver(self, name, solve, states):
+        """
+        Evaluate a solver returning whole solutions.
+
+        Parameters
+        ----------
+        name : string
+            Name of the agent in reports.
+        solve : function
+            Function returning a list of actions (or None) for a State.
+        states : list(State)
+            Test set.
+
+        Returns
+        -------
+        dict
+            Metrics (refer to _metrics()).
+
+        """
+        lengths, latencies_ns = [], []
+        for state in states:
+            start_ns = time.perf_counter_ns()
+            actions = solve(state)
+            latencies_ns.append(time.perf_counter_ns() - start_ns)
+            if actions is not None:
+                for action in actions:
+                    state = state.next_state(action)
+            lengths.append(len(actions) if (actions is not None) and state.is_cube_solved() else None)
+        return self._metrics(name, states, lengths, latencies_ns, 'solve')
+
+    # -------------------------------------------------------------------------
+
+    def evaluate_batch_policy(self, name, best_actions, states, batch_size=10_000):
+        """
+        Evaluate a batch policy choosing the actions of many states at once.
+
+        Parameters
+        ----------
+        name : string
+            Name of the agent in reports.
+        best_actions : function
+            Batch policy mapping codes to action values (refer to class BatchRollout).
+        states : list(State) or numpy.ndarray
+            Test set as states or codes.
+        batch_size : int, optional
+            Number of states advanced in lockstep. (Default: 10_000)
+
+        Returns
+        -------
+        dict
+            Metrics (refer to _metrics()) with latencies of a batch call.
+
+        """
+        codes = np.asarray(states) if isinstance(states, np.ndarray) else StateCode.encode_states(states)
+        rollout = BatchRollout(best_actions, self.max_actions, batch_size)
+        lengths = rollout.run(codes)
+        return self._metrics(name, codes, [int(n) if n >= 0 else None for n in lengths], rollout.call_latencies_ns,
+                             'batch', rollout.number_decisions)
+
+    # -------------------------------------------------------------------------
+
+    def _metrics(self, name, states, lengths, latencies_ns, latency_unit, number_decisions=None):
+        """
+        Summarize solution lengths and latencies.
+
+        Returns
+        -------
+        dict
+            name, number_states, solve_rate, optimal_rate, mean_length,
+            mean_optimal_length, mean_excess (solved states), decisions_per_s,
+            latency_unit ('decision', 'solve', or 'batch') and latency percentiles
+            p50_us, p90_us, p99_us, max_us.
+
+        """
+        if isinstance(states, np.ndarray):
+            optimal = self.distance_table.distances[states].astype(np.int32)
+        else:
+            optimal = np.array([self.distance_table.distance(state) for state in states])
+        is_solved = np.array([length is not None for length in lengths])
+        solved_lengths = np.array([length for length in lengths if length is not None])
+        excess = solved_lengths - optimal[is_solved]
+
+        latencies_us = np.array(latencies_ns, dtype=np.float64) / 1000.0
+        total_s = latencies_us.sum() / 1e6
+        if number_decisions is None:
+            number_decisions = len(latencies_ns) if latency_unit == 'decision' else int(solved_lengths.sum())
+        percentiles = np.percentile(latencies_us, [50, 90, 99]) if latencies_us.size > 0 else [0.0] * 3
+
+        return {
+            'name': name,
+            'number_states': len(states),
+            'solve_rate': float(is_solved.mean()) if len(states) > 0 else 0.0,
+            'optimal_rate': float((excess == 0).sum() / len(states)) if len(states) > 0 else 0.0,
+            'mean_length': float(solved_lengths.mean()) if solved_lengths.size > 0 else float('nan'),
+            'mean_optimal_length': float(optimal.mean()) if len(states) > 0 else float('nan'),
+            'mean_excess': float(excess.mean()) if excess.size > 0 else float('nan'),
+            'decisions_per_s': number_decisions / total_s if total_s > 0 else float('inf'),
+            'latency_unit': latency_unit,
+            'p50_us': float(percentiles[0]),
+            'p90_us': float(percentiles[1]),
+            'p99_us': float(percentiles[2]),
+            'max_us': float(latencies_us.max()) if latencies_us.size > 0 else 0.0
+        }
+
+    # ========== Report =======================================================
+
+    def print_comparison(results, title=''):
+        """
+        Print metrics of several agents side by side (one row per agent).
+
+        Parameters
+        ----------
+        results : list(dict)
+            Metrics returned by evaluate_policy() or evaluate_solver().
+        title : string, optional
+            Title of the table (e.g., test set). (Default: '')
+
+        Returns
+        -------
+        None.
+
+        """
+        print(f'\n{title}')
+        print(f'{"Agent":<24}{"solved":>8}{"optimal":>9}{"length":>8}{"excess":>8}'
+              f'{"decisions/s":>13}{"p50 [us]":>10}{"p90 [us]":>10}{"p99 [us]":>10}  per')
+        for r in results:
+            print(f'{r["name"]:<24}{100 * r["solve_rate"]:7.1f}%{100 * r["optimal_rate"]:8.1f}%'
+                  f'{r["mean_length"]:8.2f}{r["mean_excess"]:8.2f}{r["decisions_per_s"]:13_.0f}'
+                  f'{r["p50_us"]:10.1f}{r["p90_us"]:10.1f}{r["p99_us"]:10.1f}  {r["latency_unit"]}')
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'sample'))
+    from SamplePolicy import Policy
+    from RetrogradeQ import RetrogradeQ
+
+    # Agents: sample policy (if trained), optimal solver, and random actions
+    policy = Policy(len(Action))
+    policy.file_name = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'sample', policy.file_name)
+    is_policy = policy.load_from_file()
+    evaluation = PolicyEvaluation(seed=0)
+    table = evaluation.distance_table
+    retrograde = RetrogradeQ()
+
+    # Compare agents per scramble depth and on uniformly random states
+    test_sets = [(f'{depth} scrambles', evaluation.scrambled_states(depth, 200)) for depth in range(1, 7)]
+    test_sets.append(('Uniformly random states', evaluation.random_states(200)))
+    for title, states in test_sets:
+        results = [
+            evaluation.evaluate_solver('Optimal (solve)', table.solve, states),
+            evaluation.evaluate_policy('Optimal (policy)', table.best_action, states),
+            evaluation.evaluate_policy('Retrograde Q', retrograde.best_action, states),
+            evaluation.evaluate_policy('Random', lambda state: random.choice(list(Action)), states)
+        ]
+        if is_policy:
+            results.append(evaluation.evaluate_policy('Sample policy', policy.best_action, states))
+        PolicyEvaluation.print_comparison(results, title)
+
+    # Batch policies on large test sets (codes)
+    codes = BatchRollout.random_codes(1_000_000, seed=0)
+    results = [evaluation.evaluate_batch_policy('Optimal (batch)', BatchRollout.from_distances(table.distances), codes),
+               evaluation.evaluate_batch_policy('Retrograde Q (batch)', BatchRollout.from_q_table(retrograde.Q), codes)]
+    PolicyEvaluation.print_comparison(results, 'Uniformly random states (1_000_000, batch policies)')
@@ -0,0 +1,304 @@
+"""
+Hot-swap of policies between a training process and device processes.
+
+The training process publishes policies as best action tables (refer to
+class BestActionTable, 1.75 MiB) in versioned files. Running processes
+(e.g., the device application) subscribe to the directory and switch to the
+latest version between solves, without restart or reloading the policy:
+
+- publish() writes the table to a temporary file, forces it to disk, and
+  renames it to policy-<version>.npy (atomic). Only then it replaces the
+  pointer file CURRENT (atomic rename), which names the latest version.
+- Subscribers are notified by the pointer file: refresh() compares its file
+  status (inode, modification time, size) with the prior call, i.e., costs
+  a single os.stat() if nothing has been published. Otherwise it opens the
+  new version memory-mapped (no copy, pages shared between processes).
+- Solves use the table current at their start, so that a policy never
+  changes within a solve.
+- The publisher keeps the latest versions (default 3) and deletes older
+  ones, so that subscribers can still open a version they just read from
+  the pointer file.
+
+Files in the policy directory:
+    policy-<version>.npy        Best action table (packed, no pickle)
+    CURRENT                     Latest version and its file name
+
+Sample policies (dictionaries) are exported by BestActionTable.from_policy().
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add Pocket cube env and best action tables to path
+import os
+import sys
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'pocket_cube_gym'))
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'optimal'))
+
+# Other imports
+import re
+import glob
+import time
+import numpy as np
+from BestActionTable import BestActionTable
+
+# Name of the pointer file
+CURRENT_FILE = 'CURRENT'
+
+# -----------------------------------------------------------------------------
+# Files
+# -----------------------------------------------------------------------------
+
+def _version_files(directory):
+    """
+    Get (version, file name) of all published policies, sorted by version.
+    """
+    files = []
+    for file_name in glob.glob(os.path.join(directory, 'policy-*.npy')):
+        match = re.fullmatch(r'policy-(\d+)\.npy', os.path.basename(file_name))
+        if match is not None:
+            files.append((int(match.group(1)), file_name))
+    return sorted(files)
+
+# -----------------------------------------------------------------------------
+
+def _write_atomic(file_name, write, is_fsync):
+    """
+    Write a file by a temporary file and rename (readers see the old or the new file only).
+    """
+    temp_name = file_name + '.tmp'
+    with open(temp_name, 'wb') as file:
+        write(file)
+        file.flush()
+        if is_fsync:
+            os.fsync(file.fileno())
+    os.replace(temp_name, file_name)
+
+# -----------------------------------------------------------------------------
+# Publisher (training process)
+# -----------------------------------------------------------------------------
+
+class PolicyPublisher:
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, directory, keep=3, is_fsync=True):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        directory : string
+            Directory of the published policies.
+        keep : int, optional
+            Number of latest versions kept. (Default: 3)
+        is_fsync : bool, optional
+            Force files to disk before they are published. (Default: True)
+
+        Returns
+        -------
+        None.
+
+        """
+        assert keep >= 2
+        self.directory = directory
+        self.keep = keep
+        self.is_fsync = is_fsync
+        os.makedirs(directory, exist_ok=True)
+
+        # Continue the versions of prior runs
+        files = _version_files(directory)
+        self.version = files[-1][0] if len(files) > 0 else 0
+
+    # ========== Publish ======================================================
+
+    def publish(self, table):
+        """
+        Publish a new version of the policy.
+
+        Parameters
+        ----------
+        table : BestActionTable
+            Policy to publish (e.g., BestActionTable.from_policy(policy)).
+
+        Returns
+        -------
+        int
+            Version of the published policy.
+
+        """
+        version = self.version + 1
+        file_name = os.path.join(self.directory, f'policy-{version:06d}.npy')
+        _write_atomic(file_name, lambda file: np.save(file, np.asarray(table.table), allow_pickle=False), self.is_fsync)
+        _write_atomic(os.path.join(self.directory, CURRENT_FILE),
+                      lambda file: file.write(f'{version} {os.path.basename(file_name)}\n'.encode()), self.is_fsync)
+        self.version = version
+        self._delete_old_versions()
+        return version
+
+    # -------------------------------------------------------------------------
+
+    def _delete_old_versions(self):
+        """
+        Delete all but the latest versions (files still mapped on some platforms are deleted later).
+        """
+        for version, file_name in _version_files(self.directory)[:-self.keep]:
+            try:
+                os.remove(file_name)
+            except OSError:
+                pass
+
+# -----------------------------------------------------------------------------
+# Subscriber (device process)
+# -----------------------------------------------------------------------------
+
+class PolicySubscriber:
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, directory):
+        """
+        Constructor. Opens the latest published policy (if any).
+
+        Parameters
+        ----------
+        directory : string
+            Directory of the published policies.
+
+        Returns
+        -------
+        None.
+
+        """
+        self.directory = directory
+        self.table = None
+        self.version = 0
+        self.number_swaps = 0
+        self._pointer_status = None
+        self.refresh()
+
+    # ========== Switch versions ==============================================
+
+    def refresh(self):
+        """
+        Switch to the latest published version, if any (call between solves).
+
+        Returns
+        -------
+        bool
+            True if a new version has been opened, else False.
+
+        """
+        # Pointer file unchanged (one system call)
+        try:
+            status = os.stat(os.path.join(self.directory, CURRENT_FILE))
+        except OSError:
+            return False
+        pointer_status = (status.st_ino, status.st_mtime_ns, status.st_size)
+        if pointer_status == self._pointer_status:
+            return False
+
+        # Open the new version (retried on next call if deleted in between)
+        try:
+            with open(os.path.join(self.directory, CURRENT_FILE), 'r') as file:
+                version, file_name = file.read().split()
+            version = int(version)
+            if version <= self.version:
+                self._pointer_status = pointer_status
+                return False
+            table = BestActionTable.load(os.path.join(self.directory, file_name))
+        except (OSError, ValueError):
+            return False
+
+        self.table, self.version = table, version
+        self._pointer_status = pointer_status
+        self.number_swaps += 1
+        return True
+
+    # -------------------------------------------------------------------------
+
+    def wait(self, timeout_s=None, poll_interval_s=0.05):
+        """
+        Block until a new version has been opened or the timeout expired.
+
+        Returns
+        -------
+        bool
+            True if a new version has been opened, else False.
+
+        """
+        start_time = time.perf_counter()
+        while not self.refresh():
+            if (timeout_s is not None) and (time.perf_counter() - start_time >= timeout_s):
+                return False
+            time.sleep(poll_interval_s)
+        return True
+
+    # ========== Apply policy =================================================
+
+    def solve(self, state, max_actions=50):
+        """
+        Switch to the latest version and solve a state (None if unknown or nothing published).
+        """
+        self.refresh()
+        table = self.table
+        return None if table is None else table.solve(state, max_actions)
+
+    # -------------------------------------------------------------------------
+
+    def best_action(self, state):
+        """
+        Get the best action of the current version (same API as class Policy).
+        """
+        return None if self.table is None else self.table.best_action(state)
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+def _device_main(directory, duration_s):
+    """
+    Device process solving random cubes with the latest published policy.
+    """
+    import random
+    from PCubeAction import Action
+    from PCubeState import State
+
+    subscriber = PolicySubscriber(directory)
+    number_solved = number_solves = 0
+    report_time = start_time = time.perf_counter()
+    while time.perf_counter() - start_time < duration_s:
+        state = State()
+        for _ in range(random.randint(1, 14)):
+            state = state.next_state(random.choice(list(Action)))
+        number_solved += subscriber.solve(state) is not None
+        number_solves += 1
+        if time.perf_counter() - report_time >= 1.0:
+            print(f'Device: version {subscriber.version}, {100 * number_solved / number_solves:5.1f} % of {number_solves} cubes solved', flush=True)
+            number_solved = number_solves = 0
+            report_time = time.perf_counter()
+
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    import tempfile
+    import multiprocessing
+    from PCubeCode import StateCode
+    from DistanceTable import DistanceTable
+
+    # Training publishes tables knowing states of increasing distances, the device picks them up
+    distances = DistanceTable(verbose=False).distances
+    optimal = BestActionTable.from_distances(distances)
+    actions = np.stack([optimal.table & 0xF, optimal.table >> 4], axis=1).reshape(-1)[:StateCode.NUMBER_CODES]
+    with tempfile.TemporaryDirectory() as directory:
+        publisher = PolicyPublisher(directory)
+        device = multiprocessing.Process(target=_device_main, args=(directory, 8.0))
+        device.start()
+        for max_distance in range(4, 15, 2):
+            time.sleep(1.0)
+            version = publisher.publish(BestActionTable.pack(np.where(distances <= max_distance, actions, BestActionTable.NO_ACTION)))
+            print(f'Training: published version {version} (distances <= {max_distance})', flush=True)
+        device.join()
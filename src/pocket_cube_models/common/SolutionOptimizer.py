@@ -0,0 +1,306 @@
+"""
+Post-optimization of solutions generated by policies.
+
+Policies (e.g., Policy.best_action() or learned models) often solve the cube
+with detours: cancelling actions (R followed by r), loops through earlier
+states, or sections that fewer actions achieve. Each action costs servo
+commands on the device, so that solutions are shortened before they are sent:
+
+1. Cancellations: Remove actions followed by their inverse and replace three
+   equal actions by the inverse action (also across actions turning the
+   opposite face, which commute).
+2. Shortcuts (bounded search): For each intermediate state, search all
+   states within max_depth actions. If a later state of the solution is
+   among them, replace the section in between by the shorter path (loops
+   have length 0).
+3. Exact distances (optional, refer to class DistanceTable): If the cube is
+   solved in fewer actions than the remaining solution, replace it by an
+   optimal solution.
+
+States are compared by their codes (refer to class StateCode), i.e.,
+regardless of the cube's orientation as a whole. Actions after a replaced
+section are translated to the cube's orientation at the end of the new path,
+so that the result reaches the same state as the input (up to the
+orientation of the cube as a whole).
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add Pocket cube env and optimal solver to path
+import os
+import sys
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'pocket_cube_gym'))
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'optimal'))
+
+# Other imports
+import numpy as np
+from PCubeAction import Action
+from PCubeCode import StateCode
+from DistanceTable import DistanceTable
+
+class SolutionOptimizer:
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, distance_table=None, max_depth=3):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        distance_table : DistanceTable, optional
+            Exact distances replacing non-optimal solutions. Shortcuts only, if None. (Default: None)
+        max_depth : int, optional
+            Maximum length of paths searched for shortcuts. (Default: 3)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.distance_table = distance_table
+        self.max_depth = max_depth
+
+    # ========== Optimize =====================================================
+
+    def optimize(self, state, actions):
+        """
+        Get a solution with cancellations, loops, and detours removed.
+
+        Parameters
+        ----------
+        state : State
+            State the solution starts at.
+        actions : list(Action)
+            Actions of the solution (e.g., of a policy).
+
+        Returns
+        -------
+        list(Action)
+            Actions reaching the same state, at most as many as the input.
+
+        """
+        actions = SolutionOptimizer.remove_cancellations(actions)
+        actions = self.shortcut(state, actions)
+
+        # Replace non-optimal solutions
+        if self.distance_table is not None:
+            code, frame = StateCode.encode(state), StateCode.frame(state)
+            _, end_code, _ = SolutionOptimizer._walk(code, frame, actions)
+            if (end_code == StateCode.SOLVED_CODE) and (self.distance_table.distances[code] < len(actions)):
+                actions = self.distance_table.solve(state)
+        return actions
+
+    # ========== Cancellations ================================================
+
+    def remove_cancellations(actions):
+        """
+        Remove actions followed by their inverse and replace three equal actions by the inverse.
+
+        Parameters
+        ----------
+        actions : list(Action)
+            Actions to simplify.
+
+        Returns
+        -------
+        list(Action)
+            Actions with the same effect.
+
+        """
+        result = []
+        for action in actions:
+            # Last actions turning the same face (skipping actions turning the opposite face)
+            index = len(result) - 1
+            while (index >= 0) and (SolutionOptimizer.__face[result[index].value] == SolutionOptimizer.__opposite[action.value]):
+                index -= 1
+            same = index
+            while (same >= 0) and (result[same] == action):
+                same -= 1
+
+            if (index >= 0) and (result[index] == action.inverse_action()):
+                del result[index]
+            elif index - same == 2:
+                del result[same + 1:index + 1]
+                result.insert(same + 1, action.inverse_action())
+            else:
+                result.append(action)
+        return result
+
+    # ========== Shortcuts ====================================================
+
+    def shortcut(self, state, actions):
+        """
+        Replace sections of a solution by shorter paths found by bounded search.
+
+        Parameters
+        ----------
+        state : State
+            State the solution starts at.
+        actions : list(Action)
+            Actions of the solution.
+
+        Returns
+        -------
+        list(Action)
+            Actions reaching the same state, at most as many as the input.
+
+        """
+        actions = [action.value for action in actions]
+        codes, frames = SolutionOptimizer._states(StateCode.encode(state), StateCode.frame(state), actions)
+
+        i = 0
+        while i < len(actions):
+            # States within max_depth actions (canonical frame): code => (parent code, canonical action, depth)
+            ball = {codes[i]: (None, None, 0)}
+            frontier = np.array([codes[i]], dtype=np.int32)
+            for depth in range(1, self.max_depth + 1):
+                successors = StateCode.successor_codes(frontier)[:, SolutionOptimizer.__canonical]
+                new_codes = []
+                for parent, row in zip(frontier.tolist(), successors.tolist()):
+                    for action, code in zip(SolutionOptimizer.__canonical.tolist(), row):
+                        if code not in ball:
+                            ball[code] = (parent, action, depth)
+                            new_codes.append(code)
+                frontier = np.array(new_codes, dtype=np.int32)
+
+            # Latest state of the solution with the largest saving
+            best_j, best_saving = None, 0
+            for j in range(len(codes) - 1, i, -1):
+                entry = ball.get(codes[j])
+                if (entry is not None) and (j - i - entry[2] > best_saving):
+                    best_j, best_saving = j, j - i - entry[2]
+            if best_j is None:
+                i += 1
+                continue
+
+            # Replace section by the path and translate the remaining actions
+            path = []
+            code = codes[best_j]
+            while ball[code][0] is not None:
+                parent, action, _ = ball[code]
+                path.insert(0, action)
+                code = parent
+            path = SolutionOptimizer._to_physical(path, frames[i])
+            _, _, path_frame = SolutionOptimizer._walk(codes[i], frames[i], path)
+            tail = SolutionOptimizer._translate(actions[best_j:], frames[best_j], path_frame)
+            actions = actions[:i] + path + tail
+            codes, frames = SolutionOptimizer._states(codes[0], frames[0], actions)
+        return [Action(action) for action in actions]
+
+    # ========== Frames =======================================================
+
+    def _states(code, frame, actions):
+        """
+        Get the codes and frames of all states along actions (values).
+        """
+        codes, frames = [code], [frame]
+        for action in actions:
+            codes.append(StateCode.next_code(codes[-1], int(StateCode.FRAME_ACTIONS[frames[-1], action])))
+            frames.append(int(StateCode.NEXT_FRAMES[frames[-1], action]))
+        return codes, frames
+
+    # -------------------------------------------------------------------------
+
+    def _walk(code, frame, actions):
+        """
+        Get the number of actions, code, and frame after applying actions (values or Action).
+        """
+        values = [action.value if isinstance(action, Action) else action for action in actions]
+        codes, frames = SolutionOptimizer._states(code, frame, values)
+        return len(values), codes[-1], frames[-1]
+
+    # -------------------------------------------------------------------------
+
+    def _to_physical(canonical_actions, frame):
+        """
+        Get the actions (values) of a cube in a frame equal to actions in the canonical frame.
+        """
+        actions = []
+        for canonical in canonical_actions:
+            action = int(SolutionOptimizer.__physical[frame, canonical])
+            actions.append(action)
+            frame = int(StateCode.NEXT_FRAMES[frame, action])
+        return actions
+
+    # -------------------------------------------------------------------------
+
+    def _translate(actions, from_frame, to_frame):
+        """
+        Get the actions (values) in another frame that apply the same canonical actions.
+        """
+        canonical = []
+        for action in actions:
+            canonical.append(int(StateCode.FRAME_ACTIONS[from_frame, action]))
+            from_frame = int(StateCode.NEXT_FRAMES[from_frame, action])
+        return SolutionOptimizer._to_physical(canonical, to_frame)
+
+# ========== Class-level tables ===============================================
+
+# Face of each action value (R, L, U, D, F, B) and its opposite face
+SolutionOptimizer._SolutionOptimizer__face = tuple(value % 6 for value in range(12))
+SolutionOptimizer._SolutionOptimizer__opposite = tuple((value % 6) ^ 1 for value in range(12))
+
+# Canonical actions searched (L, D, B are equal to R, U, F in the canonical frame)
+SolutionOptimizer._SolutionOptimizer__canonical = np.array([action.value for action in DistanceTable.CANONICAL_ACTIONS])
+
+# Physical action of each frame and canonical action (inverse of StateCode.FRAME_ACTIONS)
+SolutionOptimizer._SolutionOptimizer__physical = np.argsort(StateCode.FRAME_ACTIONS, axis=1)
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    import random
+    import time
+    from PCubeState import State
+
+    # Noisy policy: optimal action, random action with probability 0.3
+    distance_table = DistanceTable(verbose=False)
+    def noisy_solve(state, max_actions=60):
+        actions = []
+        while (StateCode.encode(state) != StateCode.SOLVED_CODE) and (len(actions) < max_actions):
+            action = random.choice(list(Action)) if random.random() < 0.3 else distance_table.best_action(state)
+            actions.append(action)
+            state = state.next_state(action)
+        return actions
+
+    optimizers = (('Cancellations', None), ('Shortcuts', SolutionOptimizer(max_depth=3)),
+                  ('Exact distances', SolutionOptimizer(distance_table)))
+    lengths = {name: 0 for name, _ in optimizers}
+    input_length, optimal_length, number_solutions, elapsed_s = 0, 0, 0, 0.0
+    for _ in range(500):
+        state = State()
+        for _ in range(random.randint(5, 20)):
+            state = state.next_state(random.choice(list(Action)))
+        actions = noisy_solve(state)
+        end = state
+        for action in actions:
+            end = end.next_state(action)
+        if StateCode.encode(end) != StateCode.SOLVED_CODE:
+            continue
+
+        number_solutions += 1
+        input_length += len(actions)
+        optimal_length += distance_table.distance(state)
+        for name, optimizer in optimizers:
+            start_time = time.perf_counter()
+            result = SolutionOptimizer.remove_cancellations(actions) if optimizer is None else optimizer.optimize(state, actions)
+            elapsed_s += time.perf_counter() - start_time
+            lengths[name] += len(result)
+
+            # Result must solve the cube
+            end = state
+            for action in result:
+                end = end.next_state(action)
+            assert StateCode.encode(end) == StateCode.SOLVED_CODE
+
+    print(f'Average lengths of {number_solutions} policy solutions: input {input_length / number_solutions:.2f}, optimal {optimal_length / number_solutions:.2f}')
+    for name, length in lengths.items():
+        print(f'{name:<16}: {length / number_solutions:6.2f} actions ({100 * (1 - length / input_length):4.1f} % removed)')
+    print(f'Optimization time: {1000 * elapsed_s / (len(optimizers) * number_solutions):.2f} ms per solution')
@@ -0,0 +1,304 @@
+"""
+Allocation of large tables in huge pages and on NUMA nodes (Linux).
+
+Solvers access tables (e.g., DistanceTable, RetrogradeQ, BestActionTable)
+at random codes, i.e., nearly every access misses the TLB with 4 KiB pages,
+and on multi-socket machines every other access may go to remote memory.
+Tables are therefore optionally allocated in anonymous memory (instead of
+memory-mapped files) with
+
+- huge pages: 'transparent' (madvise(MADV_HUGEPAGE), 2 MiB pages assembled
+  by the kernel, see /sys/kernel/mm/transparent_hugepage/enabled) or
+  'explicit' (MAP_HUGETLB, pages reserved in /proc/sys/vm/nr_hugepages;
+  falls back to transparent huge pages if none are free), and
+- NUMA placement: a node (int), 'interleave' (pages round-robin on all
+  nodes, e.g., for tables shared by workers on all nodes), or None (first
+  touch, i.e., on the node of the process filling the table).
+
+Processes accessing their own table pin themselves to the node of the table
+(run_on_node()), e.g., shard processes of ShardedTable.start_local(numa=True)
+allocate their shard on their node. partition() places contiguous ranges of
+a table's rows on different nodes, e.g., for threads of one process filling
+their own range. The tables are private to the process, i.e., it does not
+serve builders with one process per node. Batch solvers (e.g., BatchRollout,
+ActorLearner) look up random codes, so that they use interleaved tables.
+
+The policy must be set before the pages are touched, i.e., by empty() and
+load() or by partition() right after empty().
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+import os
+import mmap
+import ctypes
+import platform
+import numpy as np
+
+class TableMemory:
+
+    # Size of huge pages (x86-64, ARM64 with 4 KiB base pages)
+    HUGE_PAGE_SIZE = 2 << 20
+
+    # Linux constants (mmap flags, mbind modes, system call numbers)
+    _MAP_HUGETLB = 0x40000
+    _MPOL_BIND, _MPOL_INTERLEAVE = 2, 3
+    _SYSCALL_MBIND = {'x86_64': 237, 'aarch64': 235}
+
+    # ========== Allocate =====================================================
+
+    def empty(shape, dtype, huge_pages=None, numa=None):
+        """
+        Allocate an uninitialized table (zero-filled by the kernel).
+
+        Parameters
+        ----------
+        shape : int or tuple(int)
+            Shape of the table.
+        dtype : numpy.dtype
+            Type of the entries.
+        huge_pages : string, optional
+            None, 'transparent', or 'explicit'. (Default: None)
+        numa : int or string, optional
+            Node, 'interleave', or None (first touch). (Default: None)
+
+        Returns
+        -------
+        numpy.ndarray
+            Table backed by anonymous memory.
+
+        """
+        assert huge_pages in (None, 'transparent', 'explicit')
+        number_bytes = int(np.prod(shape)) * np.dtype(dtype).itemsize
+        size = max(1, -(-number_bytes // TableMemory.HUGE_PAGE_SIZE)) * TableMemory.HUGE_PAGE_SIZE
+        flags = mmap.MAP_PRIVATE | mmap.MAP_ANONYMOUS
+
+        memory = None
+        if huge_pages == 'explicit':
+            try:
+                memory = mmap.mmap(-1, size, flags=flags | TableMemory._MAP_HUGETLB)
+            except OSError:
+                huge_pages = 'transparent'
+        if memory is None:
+            memory = mmap.mmap(-1, size, flags=flags)
+            if huge_pages == 'transparent':
+                memory.madvise(mmap.MADV_HUGEPAGE)
+
+        address = ctypes.addressof(ctypes.c_char.from_buffer(memory))
+        if numa == 'interleave':
+            TableMemory._mbind(address, size, TableMemory._MPOL_INTERLEAVE, TableMemory.numa_nodes())
+        elif numa is not None:
+            TableMemory._mbind(address, size, TableMemory._MPOL_BIND, [numa])
+        return np.ndarray(shape, dtype=dtype, buffer=memory)
+
+    # -------------------------------------------------------------------------
+
+    def load(file_name, huge_pages=None, numa=None):
+        """
+        Load a table saved by numpy.save() into anonymous memory (refer to empty()).
+
+        Parameters
+        ----------
+        file_name : string
+            File (.npy, no pickle).
+        huge_pages : string, optional
+            None, 'transparent', or 'explicit'. (Default: None)
+        numa : int or string, optional
+            Node, 'interleave', or None (first touch). (Default: None)
+
+        Raises
+        ------
+        ValueError
+            If the file is shorter than the table in its header.
+
+        Returns
+        -------
+        numpy.ndarray
+            Table (read-only like memory-mapped tables, private to the process).
+
+        """
+        with open(file_name, 'rb') as file:
+            version = np.lib.format.read_magic(file)
+            if version == (1, 0):
+                shape, is_fortran, dtype = np.lib.format.read_array_header_1_0(file)
+            else:
+                shape, is_fortran, dtype = np.lib.format.read_array_header_2_0(file)
+            table = TableMemory.empty(int(np.prod(shape)), dtype, huge_pages, numa)
+            buffer = memoryview(table.view(np.uint8))
+            number_read = 0
+            while number_read < len(buffer):
+                number = file.readinto(buffer[number_read:])
+                if not number:
+                    raise ValueError(f'{file_name} is truncated ({number_read:_} of {len(buffer):_} data bytes)')
+                number_read += number
+        table = table.reshape(shape, order='F' if is_fortran else 'C')
+        table.flags.writeable = False
+        return table
+
+    # ========== NUMA =========================================================
+
+    def numa_nodes():
+        """
+        Get the online NUMA nodes (list of int, [0] if unknown).
+        """
+        try:
+            with open('/sys/devices/system/node/online', 'r') as file:
+                return TableMemory._parse_list(file.read())
+        except OSError:
+            return [0]
+
+    # -------------------------------------------------------------------------
+
+    def node_cpus(node):
+        """
+        Get the CPUs of a NUMA node (list of int, all CPUs if unknown).
+        """
+        try:
+            with open(f'/sys/devices/system/node/node{node}/cpulist', 'r') as file:
+                return TableMemory._parse_list(file.read())
+        except OSError:
+            return sorted(os.sched_getaffinity(0))
+
+    # -------------------------------------------------------------------------
+
+    def run_on_node(node):
+        """
+        Pin the calling process to the CPUs of a NUMA node (e.g., at the start of a worker).
+        """
+        os.sched_setaffinity(0, TableMemory.node_cpus(node))
+
+    # -------------------------------------------------------------------------
+
+    def partition(table, nodes=None):
+        """
+        Place contiguous partitions of a table's rows on NUMA nodes (before the pages are touched).
+
+        Parameters
+        ----------
+        table : numpy.ndarray
+            Table allocated by empty() or a contiguous part of it (e.g., reshaped or sliced rows).
+        nodes : list(int), optional
+            Node of each partition. (Default: None, i.e., one partition per online node)
+
+        Returns
+        -------
+        list(tuple(int, int, int))
+            First row, end row (exclusive), and node of each partition.
+
+        """
+        assert table.flags.c_contiguous, 'Rows of the table must be contiguous'
+        nodes = TableMemory.numa_nodes() if nodes is None else nodes
+        address = table.__array_interface__['data'][0]       # Pages of empty() are mapped around it
+        row_bytes = table.nbytes // len(table)
+        page_size = mmap.PAGESIZE
+        partitions = []
+        for index, node in enumerate(nodes):
+            start, end = len(table) * index // len(nodes), len(table) * (index + 1) // len(nodes)
+            first_address = (address + start * row_bytes) // page_size * page_size
+            end_address = -(-(address + end * row_bytes) // page_size) * page_size
+            TableMemory._mbind(first_address, end_address - first_address, TableMemory._MPOL_BIND, [node])
+            partitions.append((start, end, node))
+        return partitions
+
+    # -------------------------------------------------------------------------
+
+    def _mbind(address, number_bytes, mode, nodes):
+        """
+        Set the NUMA policy of a page-aligned address range (system call mbind).
+        """
+        number = TableMemory._SYSCALL_MBIND.get(platform.machine())
+        if number is None:
+            raise OSError(f'mbind not supported on {platform.machine()}')
+        mask = ctypes.c_ulong(sum(1 << node for node in nodes))
+        libc = ctypes.CDLL(None, use_errno=True)
+        if libc.syscall(number, ctypes.c_void_p(address), ctypes.c_ulong(number_bytes), mode,
+                        ctypes.byref(mask), ctypes.c_ulong(8 * ctypes.sizeof(mask) + 1), 0) != 0:
+            raise OSError(ctypes.get_errno(), 'mbind failed')
+
+    # -------------------------------------------------------------------------
+
+    def _parse_list(text):
+        """
+        Parse a Linux CPU or node list (e.g., '0-3,8').
+        """
+        values = []
+        for item in text.strip().split(','):
+            if '-' in item:
+                first, last = item.split('-')
+                values.extend(range(int(first), int(last) + 1))
+            elif item != '':
+                values.append(int(item))
+        return values
+
+    # ========== Statistics ===================================================
+
+    def page_stats(table):
+        """
+        Get the huge pages and NUMA nodes backing a table (from /proc/self/smaps and numa_maps).
+
+        Returns
+        -------
+        dict
+            'huge_page_bytes': Bytes in huge pages, 'node_pages': Pages per node.
+
+        """
+        address = table.__array_interface__['data'][0]
+        stats = {'huge_page_bytes': 0, 'node_pages': {}}
+        with open('/proc/self/smaps', 'r') as file:
+            is_table = False
+            for line in file:
+                fields = line.split()
+                if '-' in fields[0] and ':' not in fields[0]:
+                    start, end = (int(value, 16) for value in fields[0].split('-'))
+                    is_table = start <= address < end
+                elif is_table and fields[0] in ('AnonHugePages:', 'Private_Hugetlb:'):
+                    stats['huge_page_bytes'] += 1024 * int(fields[1])
+        try:
+            with open('/proc/self/numa_maps', 'r') as file:
+                mappings = [line.split() for line in file]
+            fields = max((fields for fields in mappings if int(fields[0], 16) <= address), key=lambda fields: int(fields[0], 16))
+            for field in fields[2:]:
+                if field.startswith('N') and '=' in field:
+                    node, pages = field[1:].split('=')
+                    stats['node_pages'][int(node)] = int(pages)
+        except (OSError, ValueError):
+            pass
+        return stats
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    import time
+    import argparse
+
+    parser = argparse.ArgumentParser(description='Random table lookups with and without huge pages')
+    parser.add_argument('--mib', type=int, default=1024, help='Size of the table in MiB (one table at a time)')
+    args = parser.parse_args()
+
+    # Random gathers from a large table (e.g., 1 GiB, the size of DeviceMacroTable's tables)
+    number_entries = (args.mib << 20) // 2
+    indices = np.random.default_rng(0).integers(0, number_entries, 10_000_000)
+    for huge_pages in (None, 'transparent', 'explicit'):
+        table = TableMemory.empty(number_entries, np.uint16, huge_pages)
+        table[:] = 1
+        start_time = time.perf_counter()
+        total = int(table[indices].sum(dtype=np.int64))
+        elapsed_s = time.perf_counter() - start_time
+        stats = TableMemory.page_stats(table)
+        print(f'Huge pages {str(huge_pages):<11}: {len(indices) / elapsed_s / 1e6:6.1f} M lookups/s, '
+              f'{stats["huge_page_bytes"] / 2**20:6.0f} MiB in huge pages, pages per node {stats["node_pages"]}')
+        assert total == len(indices)
+        del table                                           # Unmaps the table before allocating the next one
+
+    # Partitions per node (e.g., one builder thread per node filling its rows)
+    table = TableMemory.empty((1 << 20, 12), np.int8, 'transparent')
+    partitions = TableMemory.partition(table)
+    for start, end, node in partitions:
+        table[start:end] = node
+    print(f'Partitions (first row, end row, node): {partitions}, pages per node {TableMemory.page_stats(table)["node_pages"]}')
@@ -0,0 +1,323 @@
+"""
+Throughput profiler for training loops.
+
+The profiler measures the time spent in named phases of a training loop (e.g.,
+env.reset, env.scramble, adding scrambles to the policy) and counts events
+(e.g., environment steps, table lookups, new table entries). Reports show
+the share of time and the rates per second of each phase and counter, and
+are printed periodically and at the end of a training run.
+
+Optionally, a sampling profiler records the functions the training thread
+is executing in fixed intervals. It shows hot spots within the phases at a
+small overhead (one stack sample per interval).
+
+Usage:
+    profiler = TrainingProfiler(report_interval_s=10.0)
+    with profiler.phase('scramble'):
+        ...
+    profiler.count('steps', 12)
+    profiler.report_if_due()
+    profiler.report()
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+import os
+import sys
+import time
+import signal
+import threading
+from collections import Counter
+
+# -----------------------------------------------------------------------------
+# Phase timer
+# -----------------------------------------------------------------------------
+
+class _Phase:
+    """
+    Context manager adding the time of a 'with' block to a phase.
+    """
+    def __init__(self, times_ns, calls, name):
+        self._times_ns = times_ns
+        self._calls = calls
+        self._name = name
+
+    def __enter__(self):
+        self._start_ns = time.perf_counter_ns()
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self._times_ns[self._name] += time.perf_counter_ns() - self._start_ns
+        self._calls[self._name] += 1
+        return False
+
+# -----------------------------------------------------------------------------
+# Sampling profiler
+# -----------------------------------------------------------------------------
+
+class SamplingProfiler:
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, interval_s=0.005):
+        """
+        Constructor.
+
+        The profiler samples the thread creating it. On Unix systems, the
+        samples are taken by a profiling timer signal (SIGPROF) that
+        interrupts the sampled thread, so that the stacks are exact. Elsewhere
+        (e.g., Windows), a background thread reads the stack of the sampled
+        thread, which is biased towards code locations that release the GIL.
+
+        Parameters
+        ----------
+        interval_s : float, optional
+            CPU time between two stack samples in seconds. (Default: 0.005)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.interval_s = interval_s
+        self.thread_id = threading.get_ident()
+        self.samples = Counter()
+        self.number_samples = 0
+        self._stop_event = threading.Event()
+        self._thread = None
+        self._is_signal = hasattr(signal, 'setitimer') and (threading.current_thread() is threading.main_thread())
+
+    # ========== Start and stop ===============================================
+
+    def start(self):
+        """
+        Start sampling.
+        """
+        if self._is_signal:
+            signal.signal(signal.SIGPROF, lambda signal_number, frame: self._add_sample(frame))
+            signal.setitimer(signal.ITIMER_PROF, self.interval_s, self.interval_s)
+        else:
+            self._stop_event.clear()
+            self._thread = threading.Thread(target=self._run, daemon=True)
+            self._thread.start()
+
+    def stop(self):
+        """
+        Stop sampling.
+        """
+        if self._is_signal:
+            signal.setitimer(signal.ITIMER_PROF, 0.0)
+            signal.signal(signal.SIGPROF, signal.SIG_DFL)
+        elif self._thread is not None:
+            self._stop_event.set()
+            self._thread.join()
+            self._thread = None
+
+    # -------------------------------------------------------------------------
+
+    def _run(self):
+        """
+        Sample the stack of the sampled thread in each interval (background thread).
+        """
+        while not self._stop_event.wait(self.interval_s):
+            frame = sys._current_frames().get(self.thread_id)
+            if frame is not None:
+                self._add_sample(frame)
+
+    # -------------------------------------------------------------------------
+
+    def _add_sample(self, frame):
+        """
+        Count the functions on a stack.
+
+        Each function is counted once per sample (inclusive time), so that
+        phases calling other functions show their total share.
+        """
+        functions = set()
+        while frame is not None:
+            code = frame.f_code
+            functions.add(f'{code.co_name} ({os.path.basename(code.co_filename)})')
+            frame = frame.f_back
+        self.samples.update(functions)
+        self.number_samples += 1
+
+    # ========== Report =======================================================
+
+    def top(self, number=10):
+        """
+        Get the most frequently sampled functions.
+
+        Parameters
+        ----------
+        number : int, optional
+            Number of functions. (Default: 10)
+
+        Returns
+        -------
+        list((string, float))
+            Functions 'name (file)' and their share of samples in percent (inclusive).
+
+        """
+        total = max(self.number_samples, 1)
+        return [(location, 100.0 * count / total) for location, count in self.samples.most_common(number)]
+
+# -----------------------------------------------------------------------------
+# Training profiler
+# -----------------------------------------------------------------------------
+
+class TrainingProfiler:
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, report_interval_s=10.0, sampling_interval_s=None):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        report_interval_s : float, optional
+            Minimum time between periodic reports in seconds (None: no periodic reports). (Default: 10.0)
+        sampling_interval_s : float, optional
+            Interval of the sampling profiler in seconds (None: no sampling profiler). (Default: None)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.report_interval_s = report_interval_s
+        self.sampling_interval_s = sampling_interval_s
+        self.sampler = None
+        self.gauges = {}
+        self.reset()
+
+    # -------------------------------------------------------------------------
+
+    def reset(self):
+        """
+        Clear all timers and counters and restart the clock.
+
+        Returns
+        -------
+        None.
+
+        """
+        self.times_ns = Counter()
+        self.calls = Counter()
+        self.counters = Counter()
+        self._start_ns = time.perf_counter_ns()
+        self._last_report_ns = self._start_ns
+        self._last_counters = Counter()
+        self._last_times_ns = Counter()
+
+    # ========== Record =======================================================
+
+    def phase(self, name):
+        """
+        Get a context manager adding the time of a 'with' block to a phase.
+        """
+        return _Phase(self.times_ns, self.calls, name)
+
+    def count(self, name, number=1):
+        """
+        Add number to a counter (e.g., steps or table lookups).
+        """
+        self.counters[name] += number
+
+    def gauge(self, name, function):
+        """
+        Register a function called for each report (e.g., memory of a table).
+
+        Parameters
+        ----------
+        name : string
+            Name of the value in reports.
+        function : function
+            Function without arguments returning a string or number.
+
+        Returns
+        -------
+        None.
+
+        """
+        self.gauges[name] = function
+
+    # ========== Sampling profiler ============================================
+
+    def start(self):
+        """
+        Restart the clock and start the sampling profiler (if configured).
+        """
+        self.reset()
+        if self.sampling_interval_s is not None:
+            self.sampler = SamplingProfiler(self.sampling_interval_s)
+            self.sampler.start()
+
+    def stop(self):
+        """
+        Stop the sampling profiler (if running).
+        """
+        if self.sampler is not None:
+            self.sampler.stop()
+
+    # ========== Reports ======================================================
+
+    def report_if_due(self):
+        """
+        Print a report of the time since the last report, if the report interval has passed.
+
+        Returns
+        -------
+        bool
+            True if a report was printed, else False.
+
+        """
+        if self.report_interval_s is None:
+            return False
+        now_ns = time.perf_counter_ns()
+        if (now_ns - self._last_report_ns) / 1e9 < self.report_interval_s:
+            return False
+
+        self._print(self.times_ns - self._last_times_ns, self.counters - self._last_counters,
+                    now_ns - self._last_report_ns, 'Interval report')
+        self._last_report_ns = now_ns
+        self._last_times_ns = self.times_ns.copy()
+        self._last_counters = self.counters.copy()
+        return True
+
+    # -------------------------------------------------------------------------
+
+    def report(self):
+        """
+        Print a report of the whole run (including the sampling profiler's hot spots).
+
+        Returns
+        -------
+        None.
+
+        """
+        self._print(self.times_ns, self.counters, time.perf_counter_ns() - self._start_ns, 'Final report')
+        if (self.sampler is not None) and (self.sampler.number_samples > 0):
+            print(f'  Sampled hot spots ({self.sampler.number_samples:_} samples):')
+            for function, percent in self.sampler.top(15):
+                print(f'    {percent:5.1f} %  {function}')
+
+    # -------------------------------------------------------------------------
+
+    def _print(self, times_ns, counters, elapsed_ns, title):
+        """
+        Print phase times, counter rates, and gauges.
+        """
+        elapsed_s = max(elapsed_ns / 1e9, 1e-9)
+        print(f'\n{title} ({elapsed_s:.1f} s):')
+        for name, time_ns in sorted(times_ns.items(), key=lambda item: -item[1]):
+            print(f'  {name:<24}{time_ns / 1e9:9.2f} s {100.0 * time_ns / 1e9 / elapsed_s:6.1f} %')
+        for name, number in sorted(counters.items()):
+            print(f'  {name:<24}{number:>12_} {number / elapsed_s:>14_.0f} /s')
+        for name, function in self.gauges.items():
+            print(f'  {name:<24}{function()}')
+        sys.stdout.flush()
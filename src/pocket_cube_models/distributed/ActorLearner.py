@@ -0,0 +1,320 @@
+"""
+Asynchronous actor-learner training of a Pocket cube quality table.
+
+Actors and the learner run in separate processes, so that each side uses its
+own cores:
+
+- Each actor process steps a batch of cubes at once (vectorized on state
+  codes, refer to class StateCode). It chooses the best known actions of the
+  published table (random actions with probability epsilon or for unknown
+  states) and sends the transitions (code, action, next code) through its own
+  shared-memory ring buffer (refer to class SharedRingBuffer) to the learner.
+  Solved cubes and cubes exceeding the maximum number of steps are replaced by
+  newly scrambled cubes.
+- The learner collects the transitions of all actors and updates its table
+  in vectorized batches with the rewards of PocketCubeEnv.step() (50 for
+  solving the cube, else -1):
+
+      Q(s,a) = max(Q(s,a), reward + max Q(s'))
+
+  States with all entries 0 are unknown (like in SamplePolicy.Policy).
+- The learner periodically publishes (copies) its table to a shared-memory
+  table read by all actors.
+
+The table is indexed by code and action in the canonical frame (refer to
+class RetrogradeQ for the exact values and the mapping of states).
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add Pocket cube env to path
+import os
+import sys
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'pocket_cube_gym'))
+
+# Other imports
+import time
+import multiprocessing
+import numpy as np
+from multiprocessing import shared_memory
+from PCubeCode import StateCode
+from SharedRingBuffer import SharedRingBuffer
+
+# Transitions sent from actors to the learner
+TRANSITION_DTYPE = np.dtype([('code', '<i4'), ('action', 'u1'), ('next_code', '<i4')])
+
+# Rewards (refer to PocketCubeEnv.step())
+SOLVED_REWARD = 50
+ACTION_REWARD = -1
+
+# -----------------------------------------------------------------------------
+# Actor (process)
+# -----------------------------------------------------------------------------
+
+def _scramble(rng, number, max_depth):
+    """
+    Get codes of cubes scrambled by 1 to max_depth random actions (not solved).
+    """
+    codes = np.full(number, StateCode.SOLVED_CODE, dtype=np.int32)
+    depths = rng.integers(1, max_depth + 1, number)
+    for step in range(max_depth):
+        is_scrambled = (step < depths) | (codes == StateCode.SOLVED_CODE)
+        actions = rng.integers(0, 12, number)
+        codes = np.where(is_scrambled, StateCode.next_codes(codes, actions), codes).astype(np.int32)
+    while (codes == StateCode.SOLVED_CODE).any():
+        is_solved = codes == StateCode.SOLVED_CODE
+        codes[is_solved] = StateCode.next_codes(codes[is_solved], rng.integers(0, 12, is_solved.sum()))
+    return codes
+
+# -----------------------------------------------------------------------------
+
+def _actor_main(ring_name, ring_capacity, ring_lock, table_name, stop_event, batch_size, max_depth, max_steps, epsilon, seed):
+    """
+    Generate transitions with the published table until the stop event is set.
+
+    Parameters
+    ----------
+    ring_name : string
+        Shared memory name of the actor's ring buffer.
+    ring_capacity : int
+        Capacity of the ring buffer in transitions.
+    ring_lock : multiprocessing.Lock
+        Lock of the ring buffer's counters.
+    table_name : string
+        Shared memory name of the published table.
+    stop_event : multiprocessing.Event
+        Event to stop the actor.
+    batch_size : int
+        Number of cubes stepped at once.
+    max_depth : int
+        Maximum number of scramble actions of new cubes.
+    max_steps : int
+        Maximum number of actions before a cube is replaced.
+    epsilon : float
+        Probability of random actions.
+    seed : int
+        Seed of the random number generator.
+
+    Returns
+    -------
+    None.
+
+    """
+    ring = SharedRingBuffer.attach(ring_name, ring_capacity, TRANSITION_DTYPE, ring_lock)
+    memory = shared_memory.SharedMemory(name=table_name)
+    table = np.ndarray((StateCode.NUMBER_CODES, 12), dtype=np.int8, buffer=memory.buf)
+    rng = np.random.default_rng(seed)
+
+    codes = _scramble(rng, batch_size, max_depth)
+    steps = np.zeros(batch_size, dtype=np.int32)
+    transitions = np.empty(batch_size, dtype=TRANSITION_DTYPE)
+    while not stop_event.is_set():
+        # Choose actions (ties broken randomly)
+        q = table[codes]
+        actions = (q + rng.random(q.shape)).argmax(axis=1)
+        is_random = (rng.random(batch_size) < epsilon) | (q.max(axis=1) <= 0)
+        actions[is_random] = rng.integers(0, 12, is_random.sum())
+        next_codes = StateCode.next_codes(codes, actions)
+
+        # Send transitions (wait while the learner is behind)
+        transitions['code'], transitions['action'], transitions['next_code'] = codes, actions, next_codes
+        number_sent = ring.put(transitions)
+        while (number_sent < batch_size) and not stop_event.is_set():
+            time.sleep(0.0005)
+            number_sent += ring.put(transitions[number_sent:])
+
+        # Replace solved cubes and cubes exceeding the maximum number of steps
+        steps += 1
+        is_done = (next_codes == StateCode.SOLVED_CODE) | (steps >= max_steps)
+        codes = next_codes.astype(np.int32)
+        codes[is_done] = _scramble(rng, is_done.sum(), max_depth)
+        steps[is_done] = 0
+
+    table = None
+    memory.close()
+    ring.close()
+
+# -----------------------------------------------------------------------------
+# Learner
+# -----------------------------------------------------------------------------
+
+class ActorLearner:
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, number_actors=None, batch_size=256, max_depth=14, max_steps=20, epsilon=0.1,
+                 ring_capacity=1 << 16, publish_interval_s=0.5):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        number_actors : int, optional
+            Number of actor processes. (Default: None, i.e., number of CPUs - 1, at least 1)
+        batch_size : int, optional
+            Number of cubes stepped at once per actor. (Default: 256)
+        max_depth : int, optional
+            Maximum number of scramble actions of new cubes. (Default: 14)
+        max_steps : int, optional
+            Maximum number of actions before a cube is replaced. (Default: 20)
+        epsilon : float, optional
+            Probability of random actions. (Default: 0.1)
+        ring_capacity : int, optional
+            Capacity of each actor's ring buffer in transitions. (Default: 65_536)
+        publish_interval_s : float, optional
+            Time between publishing the table to the actors in seconds. (Default: 0.5)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.number_actors = max(1, (os.cpu_count() or 2) - 1) if number_actors is None else number_actors
+        self.batch_size = batch_size
+        self.max_depth = max_depth
+        self.max_steps = max_steps
+        self.epsilon = epsilon
+        self.ring_capacity = ring_capacity
+        self.publish_interval_s = publish_interval_s
+
+        # Learner's table and statistics
+        self.Q = np.zeros((StateCode.NUMBER_CODES, 12), dtype=np.int8)
+        self.number_transitions = 0
+        self.number_updates = 0
+        self.number_publications = 0
+
+    # ========== Learn ========================================================
+
+    def learn(self, transitions):
+        """
+        Update the table by a batch of transitions.
+
+        Parameters
+        ----------
+        transitions : numpy.ndarray of dtype TRANSITION_DTYPE
+            Transitions (code, action, next code).
+
+        Returns
+        -------
+        int
+            Number of table entries changed.
+
+        """
+        codes, actions, next_codes = transitions['code'], transitions['action'], transitions['next_code']
+        next_max = self.Q[next_codes].max(axis=1).astype(np.int16)
+        targets = np.where(next_codes == StateCode.SOLVED_CODE, SOLVED_REWARD,
+                           np.where(next_max > 0, next_max + ACTION_REWARD, 0)).astype(np.int8)
+        before = self.Q[codes, actions]
+        np.maximum.at(self.Q, (codes, actions), targets)
+        number_changed = int((self.Q[codes, actions] != before).sum())
+        self.number_transitions += len(transitions)
+        self.number_updates += number_changed
+        return number_changed
+
+    # ========== Run actors and learner =======================================
+
+    def run(self, duration_s=10.0, report_interval_s=2.0):
+        """
+        Start the actors and learn from their transitions.
+
+        Parameters
+        ----------
+        duration_s : float, optional
+            Training time in seconds. (Default: 10.0)
+        report_interval_s : float, optional
+            Time between progress reports in seconds (None: no reports). (Default: 2.0)
+
+        Returns
+        -------
+        numpy.ndarray of shape (NUMBER_CODES, 12) and dtype int8
+            Learned table.
+
+        """
+        table_memory = shared_memory.SharedMemory(create=True, size=self.Q.nbytes)
+        published = np.ndarray(self.Q.shape, dtype=self.Q.dtype, buffer=table_memory.buf)
+        published[:] = self.Q
+        rings = [SharedRingBuffer.create(self.ring_capacity, TRANSITION_DTYPE) for _ in range(self.number_actors)]
+        stop_event = multiprocessing.Event()
+        actors = [multiprocessing.Process(target=_actor_main, daemon=True,
+                                          args=(ring.name, ring.capacity, ring.lock, table_memory.name, stop_event, self.batch_size,
+                                                self.max_depth, self.max_steps, self.epsilon, seed))
+                  for seed, ring in enumerate(rings)]
+
+        try:
+            for actor in actors:
+                actor.start()
+            start_time = time.perf_counter()
+            last_publish_time = last_report_time = start_time
+            while time.perf_counter() - start_time < duration_s:
+                # Learn from all actors' transitions
+                number_received = 0
+                for ring in rings:
+                    transitions = ring.get()
+                    if len(transitions) > 0:
+                        self.learn(transitions)
+                        number_received += len(transitions)
+                if number_received == 0:
+                    time.sleep(0.0005)
+
+                # Publish table and report progress
+                now = time.perf_counter()
+                if now - last_publish_time >= self.publish_interval_s:
+                    np.copyto(published, self.Q)
+                    self.number_publications += 1
+                    last_publish_time = now
+                if (report_interval_s is not None) and (now - last_report_time >= report_interval_s):
+                    self.report(now - start_time)
+                    last_report_time = now
+        finally:
+            stop_event.set()
+            for actor in actors:
+                actor.join()
+            for ring in rings:
+                ring.close()
+            published = None
+            table_memory.close()
+            table_memory.unlink()
+
+        return self.Q
+
+    # ========== Report =======================================================
+
+    def report(self, elapsed_s):
+        """
+        Print throughput and table coverage.
+        """
+        known = int((self.Q.max(axis=1) > 0).sum())
+        print(f'{elapsed_s:6.1f} s: {self.number_transitions:>12_} transitions ({self.number_transitions / elapsed_s:>10_.0f} /s), '
+              f'{self.number_updates:>10_} updates, {known:>9_} known states, {self.number_publications} publications', flush=True)
+
+    # -------------------------------------------------------------------------
+
+    def memory_stats(self):
+        """
+        Get memory statistics of the learner's table (refer to class MemoryStats).
+        """
+        return {'bytes': self.Q.nbytes, 'entries': int((self.Q.max(axis=1) > 0).sum()), 'max_entries': len(self.Q)}
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'optimal'))
+    from RetrogradeQ import RetrogradeQ
+    from DistanceTable import DistanceTable
+
+    trainer = ActorLearner(max_depth=6, max_steps=8)
+    table = trainer.run(duration_s=20.0)
+
+    # Compare with the exact table per distance to the solved cube
+    exact, distances = RetrogradeQ(verbose=False).Q, DistanceTable(verbose=False).distances
+    for distance in range(1, 8):
+        codes = np.flatnonzero(distances == distance)
+        is_optimal = exact[codes, table[codes].argmax(axis=1)] == exact[codes].max(axis=1)
+        is_known = table[codes].max(axis=1) > 0
+        print(f'Distance {distance}: {100 * is_known.mean():5.1f} % known, {100 * (is_known & is_optimal).mean():5.1f} % with optimal best action')
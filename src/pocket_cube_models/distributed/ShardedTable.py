@@ -0,0 +1,556 @@
+"""
+Quality table sharded across processes connected by sockets.
+
+The table Q[code][action] (int8, refer to class RetrogradeQ for the layout)
+is partitioned across shard processes: shard i stores the codes with
+code % number_shards == i in a dense array. Shards are servers listening on
+TCP sockets (local or on other nodes) or Unix domain sockets, so that the
+table may exceed the memory of a single process or machine.
+
+Clients send batched requests, i.e., one message per shard for many codes:
+
+- get(codes): Rows Q[code] of 12 values
+- max(codes): Maximum value of each row
+- update(codes, actions, values): Q[code][action] = max(Q[code][action], value)
+- assign(codes, actions, values): Q[code][action] = value
+
+Round trips are pipelined: the *_async() methods send the requests of all
+shards first and return a handle, whose result() receives the responses
+later (in order per connection). Updates are not acknowledged; sync() waits
+until all shards have applied the preceding updates. Keep the number of
+requests in flight moderate (e.g., 8 batches of 4096 codes): responses
+exceeding the socket buffers block the shards until they are received.
+
+Message format: op (1 byte) and number of codes (uint32), followed by the
+codes (int64) and, for updates, actions (uint8) and values (int8).
+
+On multi-socket machines, start_local(numa=True) pins each shard process to
+a NUMA node (round-robin) and allocates its rows on that node, optionally in
+huge pages (refer to class TableMemory), so that each shard accesses local
+memory only.
+
+Start shards on other nodes with:
+    python ShardedTable.py --serve --shard <i> --shards <n> --port <port>
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add Pocket cube env to path
+import os
+import sys
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'pocket_cube_gym'))
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'common'))
+
+# Other imports
+import socket
+import struct
+import tempfile
+import threading
+import multiprocessing
+from collections import deque
+import numpy as np
+from TableMemory import TableMemory
+
+# Message header (op, number of codes)
+HEADER = struct.Struct('<cI')
+
+# Operations
+OP_GET, OP_MAX, OP_UPDATE, OP_ASSIGN, OP_SYNC, OP_STATS, OP_CLOSE = b'G', b'M', b'U', b'A', b'Y', b'T', b'X'
+
+NUMBER_ACTIONS = 12
+
+# -----------------------------------------------------------------------------
+# Sockets
+# -----------------------------------------------------------------------------
+
+def _receive(connection, number_bytes):
+    """
+    Receive exactly number_bytes from a socket.
+    """
+    buffer = bytearray(number_bytes)
+    view = memoryview(buffer)
+    while len(view) > 0:
+        number = connection.recv_into(view)
+        if number == 0:
+            raise ConnectionError('Connection closed')
+        view = view[number:]
+    return buffer
+
+def _connect(address):
+    """
+    Connect to a shard at a (host, port) tuple or a Unix socket path (string).
+    """
+    if isinstance(address, str):
+        connection = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+    else:
+        connection = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        connection.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    connection.connect(address)
+    return connection
+
+# -----------------------------------------------------------------------------
+# Shard server (process)
+# -----------------------------------------------------------------------------
+
+class ShardServer:
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, shard, number_shards, number_codes, huge_pages=None, node=None):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        shard : int
+            Index of the shard in [0, number_shards).
+        number_shards : int
+            Number of shards.
+        number_codes : int
+            Number of codes of the whole table.
+        huge_pages : string, optional
+            None, 'transparent', or 'explicit' (refer to class TableMemory). (Default: None)
+        node : int, optional
+            NUMA node to run on and allocate the rows on. (Default: None, i.e., any)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.shard = shard
+        self.number_shards = number_shards
+        shape = ((number_codes - shard + number_shards - 1) // number_shards, NUMBER_ACTIONS)
+        if node is not None:
+            TableMemory.run_on_node(node)
+        if (huge_pages is None) and (node is None):
+            self.Q = np.zeros(shape, dtype=np.int8)
+        else:
+            self.Q = TableMemory.empty(shape, np.int8, huge_pages, node)        # Zero-filled
+        self._lock = threading.Lock()
+        self._stop_event = threading.Event()
+
+    # ========== Serve ========================================================
+
+    def serve(self, address, ready_event=None):
+        """
+        Accept clients (one thread each) until a client sends OP_CLOSE.
+
+        Parameters
+        ----------
+        address : tuple or string
+            (host, port) to listen on, or path of a Unix socket.
+        ready_event : multiprocessing.Event, optional
+            Set when the server is listening. (Default: None)
+
+        Returns
+        -------
+        None.
+
+        """
+        if isinstance(address, str):
+            listener = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+            if os.path.exists(address):
+                os.remove(address)
+        else:
+            listener = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+            listener.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        listener.bind(address)
+        listener.listen()
+        listener.settimeout(0.2)        # Check for OP_CLOSE regularly
+        if ready_event is not None:
+            ready_event.set()
+
+        try:
+            while not self._stop_event.is_set():
+                try:
+                    connection, _ = listener.accept()
+                except socket.timeout:
+                    continue
+                connection.settimeout(None)
+                if not isinstance(address, str):
+                    connection.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+                threading.Thread(target=self._handle, args=(connection,), daemon=True).start()
+        finally:
+            listener.close()
+            if isinstance(address, str) and os.path.exists(address):
+                os.remove(address)
+
+    # -------------------------------------------------------------------------
+
+    def _handle(self, connection):
+        """
+        Answer the requests of one client in order (thread).
+        """
+        try:
+            while True:
+                op, number = HEADER.unpack(_receive(connection, HEADER.size))
+                if op == OP_CLOSE:
+                    self._stop_event.set()
+                    break
+                if op == OP_SYNC:
+                    connection.sendall(b'\x01')
+                    continue
+                if op == OP_STATS:
+                    connection.sendall(struct.pack('<QQ', int((self.Q.max(axis=1) > 0).sum()), self.Q.nbytes))
+                    continue
+
+                rows = np.frombuffer(_receive(connection, 8 * number), dtype=np.int64) // self.number_shards
+                if op == OP_GET:
+                    connection.sendall(self.Q[rows].tobytes())
+                elif op == OP_MAX:
+                    connection.sendall(self.Q[rows].max(axis=1).tobytes())
+                else:
+                    data = _receive(connection, 2 * number)
+                    actions = np.frombuffer(data, dtype=np.uint8, count=number)
+                    values = np.frombuffer(data, dtype=np.int8, offset=number)
+                    with self._lock:
+                        if op == OP_UPDATE:
+                            np.maximum.at(self.Q, (rows, actions), values)
+                        else:
+                            self.Q[rows, actions] = values
+        except ConnectionError:
+            pass
+        finally:
+            connection.close()
+
+# -----------------------------------------------------------------------------
+
+def _serve_main(shard, number_shards, number_codes, address, ready_event, huge_pages, node):
+    """
+    Run a shard server (process started by ShardedTable.start_local()).
+    """
+    ShardServer(shard, number_shards, number_codes, huge_pages, node).serve(address, ready_event)
+
+# -----------------------------------------------------------------------------
+# Pending request
+# -----------------------------------------------------------------------------
+
+class PendingRequest:
+    """
+    Handle of pipelined requests to all shards (result() receives the responses).
+    """
+    def __init__(self, table, order, parts, row_bytes, dtype, shape):
+        self._table = table
+        self._order = order
+        self._parts = parts                 # (shard, number of codes) with responses pending
+        self._row_bytes = row_bytes
+        self._dtype = dtype
+        self._shape = shape
+        self._result = None
+
+    def result(self):
+        if self._result is None:
+            responses = [self._table._receive_response(shard, self, number * self._row_bytes)
+                         for shard, number in self._parts]
+            if self._order is None:
+                self._result = b''.join(responses)
+                return self._result
+            values = np.frombuffer(b''.join(responses), dtype=self._dtype).reshape((-1,) + self._shape)
+            self._result = np.empty_like(values)
+            self._result[self._order] = values
+        return self._result
+
+# -----------------------------------------------------------------------------
+# Client
+# -----------------------------------------------------------------------------
+
+class ShardedTable:
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, addresses):
+        """
+        Constructor. Connects to all shards.
+
+        Parameters
+        ----------
+        addresses : list
+            Address of each shard in shard order ((host, port) or Unix socket path).
+
+        Returns
+        -------
+        None.
+
+        """
+        self.addresses = list(addresses)
+        self.number_shards = len(self.addresses)
+        self.connections = [_connect(address) for address in self.addresses]
+        self._pending = [deque() for _ in self.addresses]      # Requests awaiting responses (per shard)
+        self._processes = []
+
+    # -------------------------------------------------------------------------
+
+    def start_local(number_shards, number_codes=None, is_unix_socket=None, huge_pages=None, numa=False):
+        """
+        Start shard processes on this machine and connect to them.
+
+        Parameters
+        ----------
+        number_shards : int
+            Number of shard processes.
+        number_codes : int, optional
+            Number of codes. (Default: None, i.e., StateCode.NUMBER_CODES)
+        is_unix_socket : bool, optional
+            Use Unix sockets instead of TCP. (Default: None, i.e., if available)
+        huge_pages : string, optional
+            None, 'transparent', or 'explicit' for the rows of each shard (refer to class TableMemory). (Default: None)
+        numa : bool, optional
+            Pin shards to NUMA nodes (round-robin) with their rows on the same node. (Default: False)
+
+        Returns
+        -------
+        ShardedTable
+            Client connected to the shards (close() stops them).
+
+        """
+        if number_codes is None:
+            from PCubeCode import StateCode
+            number_codes = StateCode.NUMBER_CODES
+        if is_unix_socket is None:
+            is_unix_socket = hasattr(socket, 'AF_UNIX')
+
+        if is_unix_socket:
+            directory = tempfile.mkdtemp()
+            addresses = [os.path.join(directory, f'shard-{shard}.sock') for shard in range(number_shards)]
+        else:
+            addresses = []
+            for _ in range(number_shards):
+                with socket.socket(socket.AF_INET, socket.SOCK_STREAM) as probe:
+                    probe.bind(('127.0.0.1', 0))
+                    addresses.append(probe.getsockname())
+
+        nodes = TableMemory.numa_nodes() if numa else [None]
+        processes = []
+        for shard, address in enumerate(addresses):
+            ready_event = multiprocessing.Event()
+            node = nodes[shard % len(nodes)]
+            process = multiprocessing.Process(target=_serve_main, daemon=True,
+                                              args=(shard, number_shards, number_codes, address, ready_event, huge_pages, node))
+            process.start()
+            ready_event.wait()
+            processes.append(process)
+
+        table = ShardedTable(addresses)
+        table._processes = processes
+        return table
+
+    # -------------------------------------------------------------------------
+
+    def close(self):
+        """
+        Disconnect (and stop shard processes started by start_local()).
+
+        Returns
+        -------
+        None.
+
+        """
+        for connection in self.connections:
+            if len(self._processes) > 0:
+                connection.sendall(HEADER.pack(OP_CLOSE, 0))
+            connection.close()
+        for process in self._processes:
+            process.join()
+        self._processes = []
+
+    # ========== Requests =====================================================
+
+    def _split(self, codes):
+        """
+        Sort codes by shard.
+
+        Returns
+        -------
+        order : numpy.ndarray
+            Indices sorting the codes by shard.
+        ranges : list((int, int, int))
+            (shard, start, end) of each shard's codes in the sorted order.
+
+        """
+        codes = np.asarray(codes, dtype=np.int64)
+        shards = codes % self.number_shards
+        order = np.argsort(shards, kind='stable')
+        ends = np.cumsum(np.bincount(shards, minlength=self.number_shards))
+        ranges = [(shard, int(ends[shard - 1]) if shard > 0 else 0, int(ends[shard])) for shard in range(self.number_shards)]
+        return codes[order], order, ranges
+
+    # -------------------------------------------------------------------------
+
+    def _request_async(self, op, codes, row_bytes, dtype, shape):
+        """
+        Send a read request to all shards and return a PendingRequest.
+        """
+        sorted_codes, order, ranges = self._split(codes)
+        request = PendingRequest(self, order, [], row_bytes, dtype, shape)
+        for shard, start, end in ranges:
+            if end > start:
+                self.connections[shard].sendall(HEADER.pack(op, end - start) + sorted_codes[start:end].tobytes())
+                self._pending[shard].append(request)
+                request._parts.append((shard, end - start))
+        return request
+
+    # -------------------------------------------------------------------------
+
+    def _receive_response(self, shard, request, number_bytes):
+        """
+        Receive the response of a shard to a request (after earlier pending ones).
+        """
+        pending = self._pending[shard]
+        while pending[0] is not request:
+            pending[0].result()
+        pending.popleft()
+        return _receive(self.connections[shard], number_bytes)
+
+    # ========== Getter =======================================================
+
+    def get_async(self, codes):
+        """
+        Request rows Q[code] (pipelined, call result() for numpy.ndarray of shape (N, 12)).
+        """
+        return self._request_async(OP_GET, codes, NUMBER_ACTIONS, np.int8, (NUMBER_ACTIONS,))
+
+    def get(self, codes):
+        """
+        Get rows Q[code] as numpy.ndarray of shape (N, 12) and dtype int8.
+        """
+        return self.get_async(codes).result()
+
+    # -------------------------------------------------------------------------
+
+    def max_async(self, codes):
+        """
+        Request maximum values of rows (pipelined, call result() for numpy.ndarray of shape (N,)).
+        """
+        return self._request_async(OP_MAX, codes, 1, np.int8, ())
+
+    def max(self, codes):
+        """
+        Get the maximum value of each row Q[code] as numpy.ndarray of shape (N,) and dtype int8.
+        """
+        return self.max_async(codes).result()
+
+    # ========== Setter =======================================================
+
+    def _write(self, op, codes, actions, values):
+        """
+        Send an update or assignment to all shards (not acknowledged).
+        """
+        codes = np.asarray(codes, dtype=np.int64)
+        actions = np.broadcast_to(np.asarray(actions, dtype=np.uint8), codes.shape)
+        values = np.broadcast_to(np.asarray(values, dtype=np.int8), codes.shape)
+        sorted_codes, order, ranges = self._split(codes)
+        actions, values = actions[order], values[order]
+        for shard, start, end in ranges:
+            if end > start:
+                self.connections[shard].sendall(HEADER.pack(op, end - start) + sorted_codes[start:end].tobytes()
+                                                + actions[start:end].tobytes() + values[start:end].tobytes())
+
+    def update(self, codes, actions, values):
+        """
+        Set Q[code][action] = max(Q[code][action], value) for a batch (not acknowledged, refer to sync()).
+        """
+        self._write(OP_UPDATE, codes, actions, values)
+
+    def assign(self, codes, actions, values):
+        """
+        Set Q[code][action] = value for a batch (not acknowledged, refer to sync()).
+        """
+        self._write(OP_ASSIGN, codes, actions, values)
+
+    # -------------------------------------------------------------------------
+
+    def sync(self):
+        """
+        Wait until all shards have processed all preceding requests.
+
+        Returns
+        -------
+        None.
+
+        """
+        requests = [self._request_async_shard(shard, OP_SYNC, 1) for shard in range(self.number_shards)]
+        for request in requests:
+            request.result()
+
+    def _request_async_shard(self, shard, op, response_bytes):
+        """
+        Send a request without codes to one shard (result() returns the response bytes).
+        """
+        request = PendingRequest(self, None, [(shard, 1)], response_bytes, None, ())
+        self.connections[shard].sendall(HEADER.pack(op, 0))
+        self._pending[shard].append(request)
+        return request
+
+    # -------------------------------------------------------------------------
+
+    def memory_stats(self):
+        """
+        Get memory statistics summed over all shards (refer to class MemoryStats).
+        """
+        requests = [self._request_async_shard(shard, OP_STATS, 16) for shard in range(self.number_shards)]
+        stats = [struct.unpack('<QQ', request.result()) for request in requests]
+        return {'bytes': sum(number_bytes for _, number_bytes in stats),
+                'entries': sum(entries for entries, _ in stats),
+                'shards': self.number_shards}
+
+# -----------------------------------------------------------------------------
+# Main (sample: throughput; or shard server on this node)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    import time
+    import argparse
+
+    parser = argparse.ArgumentParser(description='Sharded Pocket cube quality table')
+    parser.add_argument('--serve', action='store_true', help='Run a shard server')
+    parser.add_argument('--shard', type=int, default=0, help='Index of the shard to serve')
+    parser.add_argument('--shards', type=int, default=2, help='Number of shards')
+    parser.add_argument('--host', default='0.0.0.0', help='Host to listen on')
+    parser.add_argument('--port', type=int, default=7400, help='Port to listen on')
+    parser.add_argument('--batch-size', type=int, default=4096, help='Codes per request (sample)')
+    parser.add_argument('--huge-pages', choices=['transparent', 'explicit'], help='Allocate rows in huge pages')
+    parser.add_argument('--node', type=int, help='NUMA node to serve on (shard server)')
+    parser.add_argument('--numa', action='store_true', help='Pin local shards to NUMA nodes (sample)')
+    args = parser.parse_args()
+
+    from PCubeCode import StateCode
+    if args.serve:
+        ShardServer(args.shard, args.shards, StateCode.NUMBER_CODES, args.huge_pages, args.node).serve((args.host, args.port))
+        sys.exit()
+
+    table = ShardedTable.start_local(args.shards, huge_pages=args.huge_pages, numa=args.numa)
+    local = np.zeros((StateCode.NUMBER_CODES, NUMBER_ACTIONS), dtype=np.int8)
+    rng = np.random.default_rng(0)
+    codes = rng.integers(0, StateCode.NUMBER_CODES, (100, args.batch_size))
+    actions = rng.integers(0, NUMBER_ACTIONS, args.batch_size)
+    values = rng.integers(1, 50, args.batch_size)
+
+    # Updates and consistency with a local table
+    for batch in codes:
+        table.update(batch, actions, values)
+        np.maximum.at(local, (batch, actions), values.astype(np.int8))
+    table.sync()
+    print(f'Equal to local table: {(table.get(codes[0]) == local[codes[0]]).all()}, {table.memory_stats()}')
+
+    # Lookup throughput: local, sharded (one request at a time), sharded (pipelined)
+    start_time = time.perf_counter()
+    for batch in codes:
+        local[batch].max(axis=1)
+    print(f'Local:     {codes.size / (time.perf_counter() - start_time):>12_.0f} lookups/s')
+    start_time = time.perf_counter()
+    for batch in codes:
+        table.max(batch)
+    print(f'Sharded:   {codes.size / (time.perf_counter() - start_time):>12_.0f} lookups/s')
+    start_time = time.perf_counter()
+    requests = [table.max_async(batch) for batch in codes[:8]]
+    for i in range(8, len(codes) + 8):
+        requests.pop(0).result()
+        if i < len(codes):
+            requests.append(table.max_async(codes[i]))
+    print(f'Pipelined: {codes.size / (time.perf_counter() - start_time):>12_.0f} lookups/s')
+    table.close()
@@ -0,0 +1,257 @@
+"""
+Ring buffer of fixed-size records in shared memory between two processes.
+
+The buffer connects exactly one producer (e.g., an actor generating
+transitions) and one consumer (e.g., a learner) without pickling:
+
+- Records are numpy structured arrays copied into a shared memory block.
+- The producer only writes the data and the head counter, the consumer only
+  reads the data and writes the tail counter. The counters are 8-byte aligned
+  int64 values on separate cache lines and never decrease.
+- The records are copied outside of any lock. The counters are read and
+  written under a lock shared by both processes (one acquisition per put()
+  or get(), not per record). The lock orders memory accesses between the
+  processes, so that records are visible before the head counter announcing
+  them, and are read before the tail counter releasing their space, also on
+  CPUs with weak memory ordering (e.g., aarch64).
+- put() and get() do not wait for the other side. put() writes as many
+  records as fit and returns their number, i.e., the producer decides how
+  to wait.
+
+Usage:
+    buffer = SharedRingBuffer.create(capacity, dtype)                           # Owner
+    other = SharedRingBuffer.attach(buffer.name, capacity, dtype, buffer.lock)   # Other process
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+import multiprocessing
+import numpy as np
+from multiprocessing import shared_memory
+
+class SharedRingBuffer:
+
+    # Offsets of the counters (separate cache lines) and of the records in bytes
+    HEAD_OFFSET = 0
+    TAIL_OFFSET = 64
+    DATA_OFFSET = 128
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, memory, capacity, dtype, lock, is_owner):
+        """
+        Constructor. Use create() or attach() instead.
+
+        Parameters
+        ----------
+        memory : multiprocessing.shared_memory.SharedMemory
+            Shared memory block of header and records.
+        capacity : int
+            Maximum number of records in the buffer.
+        dtype : numpy.dtype
+            Type of the records.
+        lock : multiprocessing.Lock
+            Lock of the counters (shared by producer and consumer).
+        is_owner : bool
+            True if this object created (and will unlink) the shared memory.
+
+        Returns
+        -------
+        None.
+
+        """
+        self.memory = memory
+        self.name = memory.name
+        self.capacity = capacity
+        self.dtype = np.dtype(dtype)
+        self.lock = lock
+        self.is_owner = is_owner
+        self._head = np.ndarray((1,), dtype=np.int64, buffer=memory.buf, offset=SharedRingBuffer.HEAD_OFFSET)
+        self._tail = np.ndarray((1,), dtype=np.int64, buffer=memory.buf, offset=SharedRingBuffer.TAIL_OFFSET)
+        self._data = np.ndarray((capacity,), dtype=self.dtype, buffer=memory.buf, offset=SharedRingBuffer.DATA_OFFSET)
+
+    # -------------------------------------------------------------------------
+
+    def create(capacity, dtype):
+        """
+        Create a buffer in a new shared memory block.
+
+        Parameters
+        ----------
+        capacity : int
+            Maximum number of records in the buffer.
+        dtype : numpy.dtype
+            Type of the records.
+
+        Returns
+        -------
+        SharedRingBuffer
+            Empty buffer (owner of the shared memory).
+
+        """
+        size = SharedRingBuffer.DATA_OFFSET + capacity * np.dtype(dtype).itemsize
+        memory = shared_memory.SharedMemory(create=True, size=size)
+        buffer = SharedRingBuffer(memory, capacity, dtype, multiprocessing.Lock(), is_owner=True)
+        buffer._head[0] = 0
+        buffer._tail[0] = 0
+        return buffer
+
+    # -------------------------------------------------------------------------
+
+    def attach(name, capacity, dtype, lock):
+        """
+        Attach to a buffer created by another process.
+
+        The process should be started by the owner's process (multiprocessing),
+        so that both share the resource tracker releasing the memory and the
+        process inherits the lock (passed as argument of the process).
+
+        Parameters
+        ----------
+        name : string
+            Name of the shared memory block (attribute name of the owner).
+        capacity : int
+            Maximum number of records in the buffer (as created).
+        dtype : numpy.dtype
+            Type of the records (as created).
+        lock : multiprocessing.Lock
+            Lock of the counters (attribute lock of the owner).
+
+        Returns
+        -------
+        SharedRingBuffer
+            Buffer sharing the records with the owner.
+
+        """
+        memory = shared_memory.SharedMemory(name=name)
+        return SharedRingBuffer(memory, capacity, dtype, lock, is_owner=False)
+
+    # -------------------------------------------------------------------------
+
+    def close(self):
+        """
+        Detach from the shared memory (and release it, if owner).
+
+        Returns
+        -------
+        None.
+
+        """
+        self._head = self._tail = self._data = None
+        self.memory.close()
+        if self.is_owner:
+            self.memory.unlink()
+
+    # ========== Producer =====================================================
+
+    def put(self, records):
+        """
+        Append records as far as there is space (producer only).
+
+        Parameters
+        ----------
+        records : numpy.ndarray of dtype self.dtype
+            Records to append.
+
+        Returns
+        -------
+        int
+            Number of records appended (the first ones of records).
+
+        """
+        with self.lock:
+            head, tail = int(self._head[0]), int(self._tail[0])
+        number = min(len(records), self.capacity - (head - tail))
+        if number <= 0:
+            return 0
+        start = head % self.capacity
+        first = min(number, self.capacity - start)
+        self._data[start:start + first] = records[:first]
+        self._data[:number - first] = records[first:number]
+        with self.lock:                                     # Records visible before the new head
+            self._head[0] = head + number
+        return number
+
+    # ========== Consumer =====================================================
+
+    def get(self, max_records=None):
+        """
+        Remove and return the oldest records (consumer only).
+
+        Parameters
+        ----------
+        max_records : int, optional
+            Maximum number of records. (Default: None, i.e., all available)
+
+        Returns
+        -------
+        numpy.ndarray of dtype self.dtype
+            Records (copy, possibly empty).
+
+        """
+        with self.lock:
+            head, tail = int(self._head[0]), int(self._tail[0])
+        number = head - tail
+        if max_records is not None:
+            number = min(number, max_records)
+        start = tail % self.capacity
+        first = min(number, self.capacity - start)
+        records = np.concatenate((self._data[start:start + first], self._data[:number - first]))
+        with self.lock:                                     # Records read before their space is released
+            self._tail[0] = tail + number
+        return records
+
+    # ========== Getter =======================================================
+
+    def __len__(self):
+        """
+        Get the number of records in the buffer.
+        """
+        return int(self._head[0]) - int(self._tail[0])
+
+    def total_records(self):
+        """
+        Get the number of records ever appended.
+        """
+        return int(self._head[0])
+
+    def memory_stats(self):
+        """
+        Get memory statistics of the buffer (refer to class MemoryStats).
+        """
+        return {'bytes': self.memory.size, 'entries': len(self), 'max_entries': self.capacity, 'shared': True}
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+def _produce_sample(name, capacity, lock, number):
+    """
+    Producer process of the sample below (module level for process start method 'spawn').
+    """
+    buffer = SharedRingBuffer.attach(name, capacity, _SAMPLE_DTYPE, lock)
+    records = np.zeros(number, dtype=_SAMPLE_DTYPE)
+    records['index'] = np.arange(number)
+    records['value'] = np.arange(number) / 2
+    written = 0
+    while written < number:
+        written += buffer.put(records[written:written + 1000])
+    buffer.close()
+
+_SAMPLE_DTYPE = np.dtype([('index', '<i8'), ('value', '<f4')])
+
+if __name__ == '__main__':
+    buffer = SharedRingBuffer.create(4096, _SAMPLE_DTYPE)
+    producer = multiprocessing.Process(target=_produce_sample, args=(buffer.name, buffer.capacity, buffer.lock, 1_000_000))
+    producer.start()
+    received = []
+    while sum(len(r) for r in received) < 1_000_000:
+        received.append(buffer.get())
+    producer.join()
+    indices = np.concatenate(received)['index']
+    print(f'Received {len(indices):_} records in order: {(indices == np.arange(len(indices))).all()}')
+    buffer.close()
@@ -0,0 +1,398 @@
+"""
+Transposition table in shared memory for parallel searches.
+
+Searches (e.g., BFS, IDA*, MCTS, or lookahead) revisit the same states many
+times. The table stores search results per state code (refer to class
+StateCode) in a fixed-size block of shared memory, so that all search
+processes share one table instead of caching the same states each:
+
+- Entries: 2 words (uint64) per entry. The data word holds the value,
+  search depth, best action, bound type, and generation. The check word is
+  (code + 1) XOR data. Processes read and write the words without locks.
+  An entry whose words were written by different processes at the same time
+  fails the check and is treated as missing (lockless XOR hashing).
+- Buckets: 2 entries per bucket selected by a multiplicative hash of the
+  code. Entry 0 keeps the result of the deepest search (replaced by equal or
+  deeper searches and by entries of older generations), entry 1 is replaced
+  always.
+- Batches: probe() and store() handle arrays of codes (numpy), i.e., one
+  call per search level instead of per state. Codes of a batch hashing to
+  the same bucket are ranked by depth first, so that the deepest result
+  competes for entry 0 and the next one goes to entry 1.
+
+Usage:
+    table = TranspositionTable.create(number_entries)                  # Owner
+    other = TranspositionTable.attach(table.name, number_entries)      # Other process
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+import numpy as np
+from multiprocessing import shared_memory
+
+class TranspositionTable:
+
+    # Offsets of the generation counter and of the entries in bytes
+    GENERATION_OFFSET = 0
+    DATA_OFFSET = 64
+
+    # Bound types of stored values
+    EXACT, LOWER, UPPER = range(3)
+
+    # Data word: bit fields (shift, number of bits)
+    _VALUE = (0, 8)             # Value (int8)
+    _DEPTH = (8, 8)             # Remaining search depth
+    _ACTION = (16, 4)           # Best action value (0xF if none)
+    _BOUND = (20, 2)            # Bound type
+    _GENERATION = (24, 8)       # Generation of the search
+    _VALID = 63                 # Set in all stored entries
+
+    # Multiplier of the hash (golden ratio * 2^64)
+    _HASH_MULTIPLIER = np.uint64(0x9E3779B97F4A7C15)
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, memory, number_entries, is_owner):
+        """
+        Constructor. Use create() or attach() instead.
+
+        Parameters
+        ----------
+        memory : multiprocessing.shared_memory.SharedMemory
+            Shared memory block of header and entries.
+        number_entries : int
+            Number of entries (power of 2, 2 entries per bucket).
+        is_owner : bool
+            True if this object created (and will unlink) the shared memory.
+
+        Returns
+        -------
+        None.
+
+        """
+        self.memory = memory
+        self.name = memory.name
+        self.number_entries = number_entries
+        self.number_buckets = number_entries // 2
+        self.is_owner = is_owner
+        self._hash_shift = np.uint64(64 - (self.number_buckets.bit_length() - 1))
+        self._generation = np.ndarray((1,), dtype=np.uint64, buffer=memory.buf, offset=TranspositionTable.GENERATION_OFFSET)
+        self._entries = np.ndarray((self.number_buckets, 2, 2), dtype=np.uint64, buffer=memory.buf, offset=TranspositionTable.DATA_OFFSET)
+
+        # Statistics of this process
+        self.number_probes = 0
+        self.number_hits = 0
+        self.number_stores = 0
+
+    # -------------------------------------------------------------------------
+
+    def create(number_entries):
+        """
+        Create an empty table in a new shared memory block.
+
+        Parameters
+        ----------
+        number_entries : int
+            Number of entries (rounded up to a power of 2, at least 2).
+
+        Returns
+        -------
+        TranspositionTable
+            Empty table (owner of the shared memory).
+
+        """
+        number_entries = 1 << max(1, (int(number_entries) - 1).bit_length())
+        size = TranspositionTable.DATA_OFFSET + 16 * number_entries
+        memory = shared_memory.SharedMemory(create=True, size=size)
+        table = TranspositionTable(memory, number_entries, is_owner=True)
+        table._generation[0] = 0
+        table._entries[:] = 0
+        return table
+
+    # -------------------------------------------------------------------------
+
+    def attach(name, number_entries):
+        """
+        Attach to a table created by another process.
+
+        The process should be started by the owner's process (multiprocessing),
+        so that both share the resource tracker releasing the memory.
+
+        Parameters
+        ----------
+        name : string
+            Name of the shared memory block (attribute name of the owner).
+        number_entries : int
+            Number of entries (attribute number_entries of the owner).
+
+        Returns
+        -------
+        TranspositionTable
+            Table sharing the entries with the owner.
+
+        """
+        memory = shared_memory.SharedMemory(name=name)
+        return TranspositionTable(memory, number_entries, is_owner=False)
+
+    # -------------------------------------------------------------------------
+
+    def close(self):
+        """
+        Detach from the shared memory (and release it, if owner).
+
+        Returns
+        -------
+        None.
+
+        """
+        self._generation = self._entries = None
+        self.memory.close()
+        if self.is_owner:
+            self.memory.unlink()
+
+    # ========== Generations ==================================================
+
+    def new_search(self):
+        """
+        Start a new generation, so that entries of prior searches are replaced first.
+        """
+        self._generation[0] = (int(self._generation[0]) + 1) & 0xFF
+
+    # ========== Probe ========================================================
+
+    def probe(self, codes):
+        """
+        Look up the entries of a batch of codes.
+
+        Parameters
+        ----------
+        codes : numpy.ndarray of shape (N,)
+            State codes.
+
+        Returns
+        -------
+        tuple(numpy.ndarray, ...)
+            Arrays of shape (N,): found (bool), values (int8), depths (uint8),
+            actions (uint8), and bounds (uint8). Values of missing codes are undefined.
+
+        """
+        codes = np.asarray(codes, dtype=np.uint64)
+        buckets = self._bucket(codes)
+        entries = self._entries[buckets]                                    # (N, 2 entries, 2 words)
+        checks, data = entries[:, :, 0], entries[:, :, 1]
+        is_hit = ((checks ^ data) == (codes + np.uint64(1))[:, None]) & ((data >> np.uint64(TranspositionTable._VALID)) != 0)
+
+        found = is_hit.any(axis=1)
+        data = data[np.arange(len(codes)), np.argmax(is_hit, axis=1)]       # Entry 0 first
+        self.number_probes += len(codes)
+        self.number_hits += int(found.sum())
+        return (found,
+                TranspositionTable._field(data, TranspositionTable._VALUE).astype(np.uint8).view(np.int8),
+                TranspositionTable._field(data, TranspositionTable._DEPTH).astype(np.uint8),
+                TranspositionTable._field(data, TranspositionTable._ACTION).astype(np.uint8),
+                TranspositionTable._field(data, TranspositionTable._BOUND).astype(np.uint8))
+
+    # ========== Store ========================================================
+
+    def store(self, codes, values, depths, actions=None, bounds=None):
+        """
+        Store search results of a batch of codes (replacement by depth, deepest result per code of the batch).
+
+        Parameters
+        ----------
+        codes : numpy.ndarray of shape (N,)
+            State codes.
+        values : numpy.ndarray of shape (N,)
+            Values in [-128, 127] (e.g., distances).
+        depths : numpy.ndarray of shape (N,) or int
+            Remaining search depth the values result from.
+        actions : numpy.ndarray of shape (N,), optional
+            Best action values. (Default: None, i.e., 0xF)
+        bounds : numpy.ndarray of shape (N,) or int, optional
+            Bound types EXACT, LOWER, or UPPER. (Default: None, i.e., EXACT)
+
+        Returns
+        -------
+        None.
+
+        """
+        codes = np.asarray(codes, dtype=np.uint64)
+        number = len(codes)
+        if number == 0:
+            return
+        actions = np.full(number, 0xF) if actions is None else actions
+        bounds = TranspositionTable.EXACT if bounds is None else bounds
+        generation = int(self._generation[0])
+
+        data = (np.uint64(1) << np.uint64(TranspositionTable._VALID))
+        data = data | TranspositionTable._pack(np.asarray(values, dtype=np.int8).view(np.uint8), TranspositionTable._VALUE)
+        data = data | TranspositionTable._pack(np.broadcast_to(depths, number), TranspositionTable._DEPTH)
+        data = data | TranspositionTable._pack(np.asarray(actions), TranspositionTable._ACTION)
+        data = data | TranspositionTable._pack(np.broadcast_to(bounds, number), TranspositionTable._BOUND)
+        data = data | np.uint64(generation << TranspositionTable._GENERATION[0])
+        checks = data ^ (codes + np.uint64(1))
+
+        # Deepest result per code, then per bucket by decreasing depth (collisions within the batch)
+        new_depths = TranspositionTable._field(data, TranspositionTable._DEPTH).astype(np.int64)
+        order = np.lexsort((-new_depths, codes))
+        order = order[np.r_[True, codes[order][1:] != codes[order][:-1]]]
+        buckets = self._bucket(codes)
+        order = order[np.lexsort((-new_depths[order], buckets[order]))]
+        sorted_buckets = buckets[order]
+        is_first = np.r_[True, sorted_buckets[1:] != sorted_buckets[:-1]]
+        is_second = np.r_[False, is_first[:-1]] & ~is_first
+        firsts, seconds = order[is_first], order[is_second]
+
+        # Deepest result per bucket: entry 0 if empty, same code, older generation, or not deeper than the new result
+        first_buckets = buckets[firsts]
+        old_checks, old_data = self._entries[first_buckets, 0, 0], self._entries[first_buckets, 0, 1]
+        is_empty = (old_data >> np.uint64(TranspositionTable._VALID)) == 0
+        is_same = (old_checks ^ old_data) == (codes[firsts] + np.uint64(1))
+        is_old = TranspositionTable._field(old_data, TranspositionTable._GENERATION) != generation
+        is_deeper = TranspositionTable._field(old_data, TranspositionTable._DEPTH) <= TranspositionTable._field(data[firsts], TranspositionTable._DEPTH)
+        is_replacing = is_empty | is_same | is_old | is_deeper
+
+        # Entry 1: second deepest result of buckets replacing entry 0, else the deepest result
+        is_second_kept = is_replacing[np.cumsum(is_first)[is_second] - 1]
+        slot0 = firsts[is_replacing]
+        slot1 = np.concatenate((firsts[~is_replacing], seconds[is_second_kept]))
+        for slot, indices in ((0, slot0), (1, slot1)):
+            self._entries[buckets[indices], slot, 1] = data[indices]
+            self._entries[buckets[indices], slot, 0] = checks[indices]
+        self.number_stores += number
+
+    # ========== Helpers ======================================================
+
+    def _bucket(self, codes):
+        """
+        Get the bucket of each code (multiplicative hash).
+        """
+        return ((codes * TranspositionTable._HASH_MULTIPLIER) >> self._hash_shift).astype(np.int64)
+
+    # -------------------------------------------------------------------------
+
+    def _field(data, field):
+        """
+        Get a bit field (shift, bits) of data words.
+        """
+        shift, bits = field
+        return (data >> np.uint64(shift)) & np.uint64((1 << bits) - 1)
+
+    # -------------------------------------------------------------------------
+
+    def _pack(values, field):
+        """
+        Get values shifted to a bit field (shift, bits) of data words.
+        """
+        shift, bits = field
+        return (np.asarray(values).astype(np.uint64) & np.uint64((1 << bits) - 1)) << np.uint64(shift)
+
+    # ========== Getter =======================================================
+
+    def hit_rate(self):
+        """
+        Get the rate of probes of this process finding their code.
+        """
+        return self.number_hits / self.number_probes if self.number_probes > 0 else 0.0
+
+    def memory_stats(self):
+        """
+        Get memory statistics of the table (refer to class MemoryStats).
+        """
+        entries = int(((self._entries[:, :, 1] >> np.uint64(TranspositionTable._VALID)) != 0).sum())
+        return {'bytes': self.memory.size, 'entries': entries, 'max_entries': self.number_entries, 'shared': True}
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+def _lookahead(table, codes, depth, heuristic, counter):
+    """
+    Get min over paths of length depth of (path length + heuristic), using and filling the table.
+    """
+    from PCubeCode import StateCode
+
+    values = np.zeros(len(codes), dtype=np.int8)
+    found, stored_values, stored_depths, _, _ = table.probe(codes)
+    is_known = found & (stored_depths >= depth)
+    values[is_known] = stored_values[is_known]
+    is_open = (codes != StateCode.SOLVED_CODE) & ~is_known
+
+    open_codes = codes[is_open]
+    counter[0] += len(open_codes)
+    if depth == 0:
+        open_values = heuristic[open_codes]
+    else:
+        successors = StateCode.successor_codes(open_codes)[:, _SAMPLE_ACTIONS].ravel()
+        open_values = _lookahead(table, successors, depth - 1, heuristic, counter).reshape(-1, len(_SAMPLE_ACTIONS)).min(axis=1) + 1
+    values[is_open] = open_values
+    table.store(open_codes, open_values, depth)
+    return values
+
+def _search_sample(name, number_entries, seed, results):
+    """
+    Search process of the sample below (module level for process start method 'spawn').
+    """
+    import os
+    import sys
+    import time
+    sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'pocket_cube_gym'))
+    sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'optimal'))
+    sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'common'))
+    from DistanceTable import DistanceTable
+    from BatchRollout import BatchRollout
+
+    # Depth-4 lookahead of states close to each other (e.g., along solutions)
+    heuristic = np.minimum(DistanceTable(verbose=False).distances, 3)
+    table = TranspositionTable.attach(name, number_entries)
+    counter = [0]
+    start_time = time.perf_counter()
+    for batch in range(20):
+        codes = BatchRollout.scrambled_codes(6, 2000, seed=1000 * seed + batch)
+        _lookahead(table, codes, 4, heuristic, counter)
+    elapsed_s = time.perf_counter() - start_time
+    results.put((seed, counter[0], elapsed_s, table.hit_rate()))
+    table.close()
+
+_SAMPLE_ACTIONS = np.array([0, 2, 4, 6, 8, 10])      # R, U, F, r, u, f (canonical frame)
+
+if __name__ == '__main__':
+    import multiprocessing
+
+    # Correctness of probe() and store() (replacement by depth)
+    table = TranspositionTable.create(1 << 16)
+    codes = np.arange(100_000)
+    table.store(codes, codes % 12, codes % 5)
+    found, values, depths, _, _ = table.probe(codes)
+    entries = table.memory_stats()['entries']
+    print(f'Found {found.sum():_} of {len(codes):_} codes in {table.number_entries:_} entries ({100 * entries / table.number_entries:.1f} % used), '
+          f'values correct: {(values[found] == (codes % 12)[found]).all()}, depths correct: {(depths[found] == (codes % 5)[found]).all()}')
+    assert entries > 0.8 * table.number_entries
+    table.close()
+
+    # Processes with one table each vs. sharing one table
+    number_processes, number_entries = 4, 1 << 22
+    for is_shared in (False, True):
+        if is_shared:
+            tables = [TranspositionTable.create(number_entries)] * number_processes
+        else:
+            tables = [TranspositionTable.create(number_entries) for _ in range(number_processes)]
+        results = multiprocessing.Queue()
+        processes = [multiprocessing.Process(target=_search_sample, args=(table.name, number_entries, seed, results))
+                     for seed, table in enumerate(tables)]
+        for process in processes:
+            process.start()
+        outputs = [results.get() for _ in processes]
+        for process in processes:
+            process.join()
+        for table in set(tables):
+            table.close()
+
+        nodes = sum(output[1] for output in outputs)
+        elapsed_s = max(output[2] for output in outputs)
+        hit_rate = np.mean([output[3] for output in outputs])
+        print(f'{"Shared table  " if is_shared else "Private tables"}: {nodes:>12_} nodes expanded, hit rate {100 * hit_rate:5.1f} %, {elapsed_s:5.2f} s')
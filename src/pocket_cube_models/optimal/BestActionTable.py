@@ -0,0 +1,273 @@
+"""
+Table of the best action of each Pocket cube state in 4 bits.
+
+Solving a cube only requires the best action of each state, not the
+quality of all 12 actions. The table stores one action per state code
+(refer to class StateCode) in the canonical frame, two codes per byte:
+
+    action of code = (table[code // 2] >> (4 * (code % 2))) & 0xF
+
+with NO_ACTION (0xF) for the solved cube and unknown states. All 3,674,160
+codes require 1.75 MiB, i.e., the table remains in the CPU caches.
+
+Tables are exported from
+- quality tables indexed by code (e.g., RetrogradeQ.Q or ActorLearner.Q),
+- distance tables (optimal solutions, refer to DistanceTable),
+- the sample policy (dictionary Policy.Q), and
+- any function returning the best action of a state (e.g., learned models).
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add Pocket cube env to path
+import os
+import sys
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'pocket_cube_gym'))
+
+# Other imports
+import numpy as np
+from PCubeAction import Action
+from PCubeState import State
+from PCubeCode import StateCode
+
+class BestActionTable:
+
+    # Entry of codes without action (solved or unknown)
+    NO_ACTION = 0xF
+
+    # Frame of decoded (canonical) states
+    CANONICAL_FRAME = StateCode.frame(State())
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, table):
+        """
+        Constructor. Use the export or load methods to create tables.
+
+        Parameters
+        ----------
+        table : numpy.ndarray of shape ((NUMBER_CODES + 1) // 2,) and dtype uint8
+            Packed actions (two per byte).
+
+        Returns
+        -------
+        None.
+
+        """
+        self.table = table
+
+    # ========== Pack actions =================================================
+
+    def pack(actions):
+        """
+        Pack one action value per code into 4 bits each.
+
+        Parameters
+        ----------
+        actions : numpy.ndarray of shape (NUMBER_CODES,)
+            Action value (canonical frame) or NO_ACTION for each code.
+
+        Returns
+        -------
+        BestActionTable
+            Table of the actions.
+
+        """
+        actions = np.asarray(actions, dtype=np.uint8)
+        if len(actions) % 2 == 1:
+            actions = np.append(actions, np.uint8(BestActionTable.NO_ACTION))
+        return BestActionTable((actions[0::2] | (actions[1::2] << 4)).astype(np.uint8))
+
+    # ========== Export ======================================================
+
+    def from_q_table(Q):
+        """
+        Export the best actions of a quality table indexed by code and action (canonical frame).
+
+        Rows with maximum <= 0 are unknown (refer to SamplePolicy.Policy).
+        """
+        actions = StateCode.FRAME_ACTIONS[BestActionTable.CANONICAL_FRAME][np.argmax(Q, axis=1)].astype(np.uint8)
+        actions[np.max(Q, axis=1) <= 0] = BestActionTable.NO_ACTION
+        actions[StateCode.SOLVED_CODE] = BestActionTable.NO_ACTION
+        return BestActionTable.pack(actions)
+
+    # -------------------------------------------------------------------------
+
+    def from_distances(distances, chunk_size=1 << 18):
+        """
+        Export optimal actions from the distances of all codes (refer to DistanceTable).
+        """
+        actions = np.empty(StateCode.NUMBER_CODES, dtype=np.uint8)
+        for start in range(0, StateCode.NUMBER_CODES, chunk_size):
+            codes = np.arange(start, min(start + chunk_size, StateCode.NUMBER_CODES), dtype=np.int32)
+            actions[codes] = np.argmin(distances[StateCode.successor_codes(codes)], axis=1)
+        actions[StateCode.SOLVED_CODE] = BestActionTable.NO_ACTION
+        return BestActionTable.pack(actions)
+
+    # -------------------------------------------------------------------------
+
+    def from_policy(policy):
+        """
+        Export the known states of a sample policy (dictionary Q[s] of states s = positions + orientations).
+        """
+        actions = np.full(StateCode.NUMBER_CODES, BestActionTable.NO_ACTION, dtype=np.uint8)
+        values = {}     # Highest value per code (states in several orientations of the cube share a code)
+        for s, q in policy.Q.items():
+            state = State(s[:8], s[8:])
+            code, value = StateCode.encode(state), q.max()
+            if value > values.get(code, 0):
+                values[code] = value
+                actions[code] = StateCode.FRAME_ACTIONS[StateCode.frame(state), int(q.argmax())]
+        actions[StateCode.SOLVED_CODE] = BestActionTable.NO_ACTION
+        return BestActionTable.pack(actions)
+
+    # -------------------------------------------------------------------------
+
+    def from_function(best_action, codes=None):
+        """
+        Export the actions of a function (State -> Action or None), e.g., a learned model.
+
+        Parameters
+        ----------
+        best_action : function
+            Function returning the best action of a state.
+        codes : iterable(int), optional
+            Codes to export (others are unknown). (Default: None, i.e., all codes; slow)
+
+        Returns
+        -------
+        BestActionTable
+            Table of the actions.
+
+        """
+        actions = np.full(StateCode.NUMBER_CODES, BestActionTable.NO_ACTION, dtype=np.uint8)
+        for code in (range(1, StateCode.NUMBER_CODES) if codes is None else codes):
+            action = best_action(StateCode.decode(code))
+            if action is not None:
+                actions[code] = StateCode.FRAME_ACTIONS[BestActionTable.CANONICAL_FRAME, action.value]
+        actions[StateCode.SOLVED_CODE] = BestActionTable.NO_ACTION
+        return BestActionTable.pack(actions)
+
+    # ========== File I/O =====================================================
+
+    def save(self, file_name):
+        """
+        Save the table as .npy file.
+        """
+        np.save(file_name, self.table)
+
+    def load(file_name):
+        """
+        Load a table from .npy file (memory-mapped).
+        """
+        return BestActionTable(np.load(file_name, mmap_mode='r'))
+
+    # ========== Getter =======================================================
+
+    def code_action(self, code):
+        """
+        Get the action value (canonical frame) of a code, or NO_ACTION.
+        """
+        return (int(self.table[code >> 1]) >> ((code & 1) << 2)) & 0xF
+
+    # -------------------------------------------------------------------------
+
+    def code_actions(self, codes):
+        """
+        Get the action values (canonical frame) of a batch of codes as numpy.ndarray of dtype uint8.
+        """
+        return (self.table[codes >> 1] >> ((codes & 1) << 2).astype(np.uint8)) & 0xF
+
+    # -------------------------------------------------------------------------
+
+    def best_action(self, state):
+        """
+        Get the best action of a state (same API as class Policy), or None if unknown or solved.
+        """
+        action = self.code_action(StateCode.encode(state))
+        if action == BestActionTable.NO_ACTION:
+            return None
+        return Action(int(BestActionTable.__frame_actions[StateCode.frame(state), action]))
+
+    # -------------------------------------------------------------------------
+
+    def solve(self, state, max_actions=50):
+        """
+        Get the actions to solve a state by following the table (None if a state is unknown).
+        """
+        actions = []
+        code, frame = StateCode.encode(state), StateCode.frame(state)
+        while (code != StateCode.SOLVED_CODE) and (len(actions) < max_actions):
+            canonical_action = self.code_action(code)
+            if canonical_action == BestActionTable.NO_ACTION:
+                return None
+            action = int(BestActionTable.__frame_actions[frame, canonical_action])
+            actions.append(Action(action))
+            code = StateCode.next_code(code, canonical_action)
+            frame = int(StateCode.NEXT_FRAMES[frame, action])
+        return actions if code == StateCode.SOLVED_CODE else None
+
+    # -------------------------------------------------------------------------
+
+    def memory_stats(self):
+        """
+        Get memory statistics of the table (refer to class MemoryStats).
+        """
+        return {'bytes': self.table.nbytes, 'entries': 2 * self.table.size, 'shared': isinstance(self.table, np.memmap)}
+
+    # ========== Create tables ================================================
+
+    def _create_frame_actions():
+        """
+        Map canonical actions to actions in each frame (inverse of StateCode.FRAME_ACTIONS).
+
+        Returns
+        -------
+        numpy.ndarray of shape (24, 12) and dtype int8
+            Action value in the frame for each frame and canonical action value (-1 if none).
+
+        """
+        frame_actions = np.full((24, 12), -1, dtype=np.int8)
+        for frame in range(24):
+            for action in range(11, -1, -1):
+                frame_actions[frame, StateCode.FRAME_ACTIONS[frame, action]] = action
+        return frame_actions
+
+# ========== Class-level tables (require the class to be defined) =============
+
+BestActionTable._BestActionTable__frame_actions = BestActionTable._create_frame_actions()
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    import time
+    import random
+    from DistanceTable import DistanceTable
+
+    distances = DistanceTable(verbose=False)
+    table = BestActionTable.from_distances(distances.distances)
+    print(f'Table: {table.table.nbytes / 2**20:.2f} MiB')
+
+    # Solve random states (optimal lengths)
+    for _ in range(5):
+        state = State()
+        for _ in range(30):
+            state = state.next_state(random.choice(list(Action)))
+        solution = table.solve(state)
+        print(f'Optimal length {distances.distance(state):2}, table: {len(solution):2} {[action.name for action in solution]}')
+
+    # Vectorized rollouts of random codes
+    codes = np.random.default_rng(0).integers(0, StateCode.NUMBER_CODES, 1_000_000).astype(np.int32)
+    number_decisions = 0
+    start_time = time.perf_counter()
+    while len(codes) > 0:
+        codes = StateCode.next_codes(codes, table.code_actions(codes))
+        number_decisions += len(codes)
+        codes = codes[codes != StateCode.SOLVED_CODE]
+    print(f'Rollouts: {number_decisions / (time.perf_counter() - start_time):_.0f} decisions/s')
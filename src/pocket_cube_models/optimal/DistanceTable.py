@@ -0,0 +1,207 @@
+"""
+Table of optimal solution lengths of all Pocket cube states.
+
+The table stores the minimum number of quarter turns (actions) to solve the
+cube for each of the 3,674,160 state codes (refer to class StateCode). It is
+generated once by a breadth-first search starting at the solved cube and
+stored as .npy file (3.5 MiB). Afterwards, it is opened as memory-mapped file.
+
+The table provides optimal solutions for all states and the optimal lengths
+used to evaluate policies and solvers.
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add Pocket cube env and table memory to path
+import os
+import sys
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'pocket_cube_gym'))
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'common'))
+
+# Other imports
+import time
+import numpy as np
+from PCubeAction import Action
+from PCubeCode import StateCode
+from TableMemory import TableMemory
+
+class DistanceTable:
+
+    # Default directory to store the table in
+    DEFAULT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'tables')
+    FILE_NAME = 'PCube_Distances.npy'
+
+    # Actions in the canonical frame (L, D, B are equal to R, U, F there)
+    CANONICAL_ACTIONS = (Action.R, Action.U, Action.F, Action.r, Action.u, Action.f)
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, table_dir=None, verbose=True, huge_pages=None, numa=None):
+        """
+        Constructor. Opens the table, generating it if missing.
+
+        Parameters
+        ----------
+        table_dir : string, optional
+            Directory containing the table file. (Default: DEFAULT_DIR)
+        verbose : bool, optional
+            Print progress when the table is generated. (Default: True)
+        huge_pages : string, optional
+            Load the table into huge pages, 'transparent' or 'explicit' (refer to
+            class TableMemory). Memory-mapped file, if None. (Default: None)
+        numa : int or string, optional
+            NUMA node or 'interleave' of the loaded table. (Default: None)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.table_dir = DistanceTable.DEFAULT_DIR if table_dir is None else table_dir
+        file_name = os.path.join(self.table_dir, DistanceTable.FILE_NAME)
+
+        if not os.path.exists(file_name):
+            if verbose:
+                print('Generating Pocket cube distance table ... ', end='', flush=True)
+            start_time_ns = time.time_ns()
+            table = DistanceTable.generate()
+            os.makedirs(self.table_dir, exist_ok=True)
+            temp_name = f'{file_name}.{os.getpid()}.tmp'
+            with open(temp_name, 'wb') as file:
+                np.save(file, table)
+            os.replace(temp_name, file_name)
+            if verbose:
+                print(f'ok ({(time.time_ns() - start_time_ns) / 1e9:.1f} s)')
+
+        if (huge_pages is None) and (numa is None):
+            self.distances = np.load(file_name, mmap_mode='r')
+        else:
+            self.distances = TableMemory.load(file_name, huge_pages, numa)
+        self.max_distance = int(self.distances.max())
+
+    # ========== Generate table ===============================================
+
+    def generate():
+        """
+        Breadth-first search for the distances of all codes to the solved cube.
+
+        Returns
+        -------
+        numpy.ndarray of shape (NUMBER_CODES,) and dtype int8
+            Minimum number of actions to solve the cube.
+
+        """
+        actions = np.array([action.value for action in DistanceTable.CANONICAL_ACTIONS])
+        distances = np.full(StateCode.NUMBER_CODES, -1, dtype=np.int8)
+        distances[StateCode.SOLVED_CODE] = 0
+        frontier = np.array([StateCode.SOLVED_CODE], dtype=np.int32)
+        depth = 0
+        while frontier.size > 0:
+            successors = StateCode.successor_codes(frontier)[:, actions].ravel()
+            depth += 1
+            distances[successors[distances[successors] < 0]] = depth
+            frontier = np.flatnonzero(distances == depth).astype(np.int32)
+        return distances
+
+    # ========== Getter =======================================================
+
+    def distance(self, state):
+        """
+        Get the minimum number of actions to solve a state.
+        """
+        return int(self.distances[StateCode.encode(state)])
+
+    # -------------------------------------------------------------------------
+
+    def action_distances(self, state):
+        """
+        Get the minimum number of actions to solve the state after each action.
+
+        Parameters
+        ----------
+        state : State
+            State to apply the actions to.
+
+        Returns
+        -------
+        numpy.ndarray of shape (12,)
+            Distance after each action (indexed by action value).
+
+        """
+        code, frame = StateCode.encode(state), StateCode.frame(state)
+        successors = StateCode.successor_codes(np.array([code]))[0]
+        return self.distances[successors[StateCode.FRAME_ACTIONS[frame]]]
+
+    # -------------------------------------------------------------------------
+
+    def best_action(self, state):
+        """
+        Get an action of an optimal solution (same API as class Policy).
+        """
+        return Action(int(self.action_distances(state).argmin()))
+
+    # -------------------------------------------------------------------------
+
+    def solve(self, state):
+        """
+        Get an optimal solution.
+
+        Parameters
+        ----------
+        state : State
+            State to solve.
+
+        Returns
+        -------
+        list(Action)
+            Actions solving the cube with the minimum number of actions.
+
+        """
+        actions = []
+        code, frame = StateCode.encode(state), StateCode.frame(state)
+        while self.distances[code] > 0:
+            successors = StateCode.successor_codes(np.array([code]))[0][StateCode.FRAME_ACTIONS[frame]]
+            action = int(self.distances[successors].argmin())
+            actions.append(Action(action))
+            code = int(successors[action])
+            frame = int(StateCode.NEXT_FRAMES[frame, action])
+        return actions
+
+    # -------------------------------------------------------------------------
+
+    def histogram(self):
+        """
+        Get the number of states for each distance.
+        """
+        return np.bincount(self.distances, minlength=self.max_distance + 1)
+
+    # -------------------------------------------------------------------------
+
+    def memory_stats(self):
+        """
+        Get memory statistics of the table (shared between processes if memory-mapped).
+        """
+        return {'bytes': self.distances.nbytes, 'entries': self.distances.size, 'shared': isinstance(self.distances, np.memmap)}
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    import random
+    from PCubeState import State
+
+    table = DistanceTable()
+    print('States per distance:', table.histogram())
+
+    state = State()
+    for _ in range(30):
+        state = state.next_state(random.choice(list(Action)))
+    solution = table.solve(state)
+    for action in solution:
+        state = state.next_state(action)
+    print(f'Optimal solution {[action.name for action in solution]} solves cube: {state.is_cube_solved()}')
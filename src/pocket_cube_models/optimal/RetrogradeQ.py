@@ -0,0 +1,200 @@
+"""
+Exact quality table Q(s,a) of all Pocket cube states by retrograde analysis.
+
+The sample policy (refer to SamplePolicy.Policy) learns the maximum future
+rewards Q(s,a) of state/action pairs from random episodes. With rewards of
+-1 per action and 50 for solving the cube (refer to PocketCubeEnv.step()),
+the exact values are
+
+    Q(s,a) = 50 - d(s')
+
+with s' being the state after applying a to s and d(s') its minimum number
+of actions to the solved cube. The solved cube is terminal, i.e., its row is
+0 (like unknown states in the sample policy). Note that SampleAgent adds the
+reward -1 of the scramble action to the stored values once more, i.e., its
+values are smaller, but decrease with the distance, too (same best actions).
+
+The distances d result from a breadth-first search backwards from the solved
+cube, layer by layer (refer to class DistanceTable). Codes identify cubes
+independent of their orientation, so that the 24 solved states are the single
+code 0. The table is indexed by code and action (in the canonical frame),
+generated for all 3,674,160 codes at once by vectorized lookups, stored as
+.npy file (42 MiB int8), and opened as memory-mapped file.
+
+The class provides the getters of class Policy, i.e., can replace it.
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add Pocket cube env and table memory to path
+import os
+import sys
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'pocket_cube_gym'))
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'common'))
+
+# Other imports
+import time
+import numpy as np
+from PCubeAction import Action
+from PCubeCode import StateCode
+from TableMemory import TableMemory
+from DistanceTable import DistanceTable
+
+class RetrogradeQ:
+
+    # Default directory to store the table in
+    DEFAULT_DIR = DistanceTable.DEFAULT_DIR
+    FILE_NAME = 'PCube_Quality.npy'
+
+    # Rewards (refer to PocketCubeEnv.step())
+    SOLVED_REWARD = 50
+    ACTION_REWARD = -1
+
+    # Number of codes processed at once when generating the table
+    CHUNK_SIZE = 1 << 18
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, table_dir=None, verbose=True, huge_pages=None, numa=None):
+        """
+        Constructor. Opens the table, generating it (and the distance table) if missing.
+
+        Parameters
+        ----------
+        table_dir : string, optional
+            Directory containing the table files. (Default: DEFAULT_DIR)
+        verbose : bool, optional
+            Print progress when the table is generated. (Default: True)
+        huge_pages : string, optional
+            Load the table into huge pages, 'transparent' or 'explicit' (refer to
+            class TableMemory). Memory-mapped file, if None. (Default: None)
+        numa : int or string, optional
+            NUMA node or 'interleave' of the loaded table. (Default: None)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.table_dir = RetrogradeQ.DEFAULT_DIR if table_dir is None else table_dir
+        file_name = os.path.join(self.table_dir, RetrogradeQ.FILE_NAME)
+
+        if not os.path.exists(file_name):
+            distances = DistanceTable(self.table_dir, verbose).distances
+            if verbose:
+                print('Generating Pocket cube quality table ... ', end='', flush=True)
+            start_time_ns = time.time_ns()
+            table = RetrogradeQ.generate(distances)
+            temp_name = f'{file_name}.{os.getpid()}.tmp'
+            with open(temp_name, 'wb') as file:
+                np.save(file, table)
+            os.replace(temp_name, file_name)
+            if verbose:
+                print(f'ok ({(time.time_ns() - start_time_ns) / 1e9:.1f} s)')
+
+        if (huge_pages is None) and (numa is None):
+            self.Q = np.load(file_name, mmap_mode='r')
+        else:
+            self.Q = TableMemory.load(file_name, huge_pages, numa)
+
+    # ========== Generate table ===============================================
+
+    def generate(distances):
+        """
+        Get the quality of all state/action pairs from the distances of all codes.
+
+        Parameters
+        ----------
+        distances : numpy.ndarray of shape (NUMBER_CODES,)
+            Minimum number of actions to solve each code (refer to DistanceTable.generate()).
+
+        Returns
+        -------
+        numpy.ndarray of shape (NUMBER_CODES, 12) and dtype int8
+            Maximum future rewards, indexed by code and action value (canonical frame).
+
+        """
+        distances = np.asarray(distances, dtype=np.int8)
+        table = np.empty((StateCode.NUMBER_CODES, len(Action)), dtype=np.int8)
+        for start in range(0, StateCode.NUMBER_CODES, RetrogradeQ.CHUNK_SIZE):
+            codes = np.arange(start, min(start + RetrogradeQ.CHUNK_SIZE, StateCode.NUMBER_CODES), dtype=np.int32)
+            table[codes] = RetrogradeQ.SOLVED_REWARD + RetrogradeQ.ACTION_REWARD * distances[StateCode.successor_codes(codes)]
+        table[StateCode.SOLVED_CODE] = 0
+        return table
+
+    # ========== Getter (API of class Policy) =================================
+
+    def to_index_s(self, state):
+        """
+        Get the index 's' to the table Q[s][a] (code of the state).
+        """
+        return StateCode.encode(state)
+
+    # -------------------------------------------------------------------------
+
+    def action_rewards(self, state):
+        """
+        Get the maximum future rewards of all actions applied to a state.
+
+        Parameters
+        ----------
+        state : State
+            State s to apply the actions to.
+
+        Returns
+        -------
+        numpy.ndarray of shape (12,)
+            Q(s,a) indexed by action value (in the frame of the state).
+
+        """
+        return self.Q[StateCode.encode(state), StateCode.FRAME_ACTIONS[StateCode.frame(state)]]
+
+    # -------------------------------------------------------------------------
+
+    def max_rewards(self, state):
+        """
+        Get maximum rewards (including future rewards) for a state.
+        """
+        return int(self.Q[StateCode.encode(state)].max())
+
+    # -------------------------------------------------------------------------
+
+    def best_action(self, state):
+        """
+        Get action with highest future rewards for a state.
+        """
+        return Action(int(self.action_rewards(state).argmax()))
+
+    # -------------------------------------------------------------------------
+
+    def memory_stats(self):
+        """
+        Get memory statistics of the table (shared between processes if memory-mapped).
+        """
+        return {'bytes': self.Q.nbytes, 'entries': self.Q.size, 'shared': isinstance(self.Q, np.memmap)}
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    import random
+    from PCubeState import State
+
+    policy = RetrogradeQ()
+    distances = DistanceTable(verbose=False)
+
+    # Following the best actions solves random cubes optimally
+    for _ in range(5):
+        state = State()
+        for _ in range(30):
+            state = state.next_state(random.choice(list(Action)))
+        optimal_length, actions = distances.distance(state), []
+        while not state.is_cube_solved():
+            actions.append(policy.best_action(state))
+            state = state.next_state(actions[-1])
+        print(f'Optimal length {optimal_length:2}, policy: {[action.name for action in actions]}')
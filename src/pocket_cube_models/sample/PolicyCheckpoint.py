@@ -0,0 +1,350 @@
+"""
+Incremental, crash-safe checkpoints of the sample policy.
+
+Policy.save_to_file() rewrites the whole table each time. Instead, the
+checkpoint records each update Q[s][a] = value of the policy (refer to
+Policy.update_hooks) and appends it to a log file:
+
+- Training only appends a tuple to a deque (no I/O, no locks; appends and
+  pops of a deque are thread-safe).
+- A background thread writes the pending records to the log in fixed-size
+  binary records (16 bytes state, 1 byte action, 4 bytes value) in regular
+  intervals and flushes them to disk.
+- After a number of records, the background thread compacts the log into a
+  flat snapshot of the table (.npy without pickle): new records go to the
+  next log file, a copy of the table (including entries spilled to disk,
+  refer to Policy.to_dict()) is written to a temporary file and renamed, and
+  only then older logs and snapshots are deleted.
+
+Recovery loads the latest snapshot and replays the logs written after it. A
+record torn by a crash at the end of the log is ignored, i.e., at most the
+updates of the last flush interval are lost.
+
+Files in the checkpoint directory:
+    snapshot-<generation>.npy   Table containing all updates of older logs
+    log-<generation>.bin        Updates after the snapshot of the same or lower generation
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+import os
+import re
+import glob
+import time
+import threading
+import numpy as np
+from collections import deque
+
+class PolicyCheckpoint:
+
+    # Size of the state index (positions and orientations of 8 cubies)
+    STATE_SIZE = 16
+
+    # Binary formats of log records and snapshot rows
+    LOG_DTYPE = np.dtype([('s', np.uint8, STATE_SIZE), ('a', np.uint8), ('value', '<i4')])
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, policy, directory=None, flush_interval_s=1.0, compact_records=1_000_000, is_fsync=True):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        policy : Policy
+            Policy to checkpoint.
+        directory : string, optional
+            Directory of log and snapshot files. (Default: None, i.e., policy.file_name + '.checkpoint')
+        flush_interval_s : float, optional
+            Time between writes of pending records in seconds. (Default: 1.0)
+        compact_records : int, optional
+            Number of logged records triggering a compaction. (Default: 1_000_000)
+        is_fsync : bool, optional
+            Force written records to disk (survive power loss, not only crashes). (Default: True)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.policy = policy
+        self.directory = policy.file_name + '.checkpoint' if directory is None else directory
+        self.flush_interval_s = flush_interval_s
+        self.compact_records = compact_records
+        self.is_fsync = is_fsync
+        os.makedirs(self.directory, exist_ok=True)
+
+        # Log state
+        self.generation = max([0] + [g for g, _ in self._files('log') + self._files('snapshot')])
+        self.logged_records = 0
+        self.number_compactions = 0
+        self._pending = deque()                 # Appended by training, drained by the writer (thread-safe)
+        self._log = None
+        self._lock = threading.RLock()
+        self._stop_event = threading.Event()
+        self._thread = None
+
+    # ========== Files ========================================================
+
+    def _files(self, kind):
+        """
+        Get (generation, file name) of all logs or snapshots, sorted by generation.
+        """
+        files = []
+        for file_name in glob.glob(os.path.join(self.directory, f'{kind}-*')):
+            match = re.fullmatch(kind + r'-(\d+)\.(bin|npy)', os.path.basename(file_name))
+            if match is not None:
+                files.append((int(match.group(1)), file_name))
+        return sorted(files)
+
+    def _file_name(self, kind, generation):
+        """
+        Get the file name of a log or snapshot.
+        """
+        extension = 'bin' if kind == 'log' else 'npy'
+        return os.path.join(self.directory, f'{kind}-{generation:06d}.{extension}')
+
+    # ========== Record updates ===============================================
+
+    def _record(self, s, a, value):
+        """
+        Queue an update of the policy (hook called by Policy.add()).
+        """
+        self._pending.append((s, a, value))
+
+    # -------------------------------------------------------------------------
+
+    def start(self):
+        """
+        Start recording updates of the policy and writing them in the background.
+
+        Returns
+        -------
+        None.
+
+        """
+        file_name = self._file_name('log', self.generation)
+        if os.path.exists(file_name):
+            # Remove a record torn by a crash (appended records must start at record boundaries)
+            size = os.path.getsize(file_name)
+            os.truncate(file_name, size - size % PolicyCheckpoint.LOG_DTYPE.itemsize)
+        self._log = open(file_name, 'ab')
+        self.policy.update_hooks.append(self._record)
+        self._stop_event.clear()
+        self._thread = threading.Thread(target=self._run, daemon=True)
+        self._thread.start()
+
+    # -------------------------------------------------------------------------
+
+    def stop(self):
+        """
+        Stop recording and write all pending updates.
+
+        Returns
+        -------
+        None.
+
+        """
+        if self._record in self.policy.update_hooks:
+            self.policy.update_hooks.remove(self._record)
+        if self._thread is not None:
+            self._stop_event.set()
+            self._thread.join()
+            self._thread = None
+        self.flush()
+        if self._log is not None:
+            self._log.close()
+            self._log = None
+
+    # -------------------------------------------------------------------------
+
+    def __enter__(self):
+        self.start()
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.stop()
+        return False
+
+    # ========== Background writing ===========================================
+
+    def _run(self):
+        """
+        Write pending records in each interval and compact when due (background thread).
+        """
+        while not self._stop_event.wait(self.flush_interval_s):
+            self.flush()
+            if self.logged_records >= self.compact_records:
+                self.compact()
+
+    # -------------------------------------------------------------------------
+
+    def flush(self):
+        """
+        Append all pending records to the log and flush it to disk.
+
+        Returns
+        -------
+        int
+            Number of records written.
+
+        """
+        with self._lock:
+            if self._log is None:
+                return 0
+            pending = [self._pending.popleft() for _ in range(len(self._pending))]
+            if len(pending) == 0:
+                return 0
+
+            records = np.empty(len(pending), dtype=PolicyCheckpoint.LOG_DTYPE)
+            records['s'] = [s for s, _, _ in pending]
+            records['a'] = [a for _, a, _ in pending]
+            records['value'] = [value for _, _, value in pending]
+            self._log.write(records.tobytes())
+            self._log.flush()
+            if self.is_fsync:
+                os.fsync(self._log.fileno())
+            self.logged_records += len(pending)
+            return len(pending)
+
+    # ========== Compaction ===================================================
+
+    def compact(self):
+        """
+        Write a snapshot of the policy and delete older logs and snapshots.
+
+        Updates until the start of the new log are contained in the copy of
+        the table. Updates during copying may be contained, too, but are
+        logged in the new log, i.e., are replayed in order when recovering.
+
+        Returns
+        -------
+        None.
+
+        """
+        # Start new log (subsequent records go there)
+        with self._lock:
+            self.flush()
+            self._log.close()
+            self.generation += 1
+            self._log = open(self._file_name('log', self.generation), 'ab')
+            self.logged_records = 0
+            generation = self.generation
+            table = self.policy.to_dict()           # Including entries spilled to disk
+
+        # Write snapshot (atomic rename)
+        file_name = self._file_name('snapshot', generation)
+        temp_name = file_name + '.tmp'
+        with open(temp_name, 'wb') as file:
+            np.save(file, PolicyCheckpoint.to_array(table), allow_pickle=False)
+            file.flush()
+            if self.is_fsync:
+                os.fsync(file.fileno())
+        os.replace(temp_name, file_name)
+
+        # Delete files contained in the snapshot
+        for g, name in self._files('log') + self._files('snapshot'):
+            if g < generation:
+                os.remove(name)
+        self.number_compactions += 1
+
+    # ========== Conversion ===================================================
+
+    def to_array(table):
+        """
+        Get a table {s: Q[s]} as flat structured array with fields 's' and 'q'.
+        """
+        number_actions = len(next(iter(table.values()))) if len(table) > 0 else 0
+        dtype = np.dtype([('s', np.uint8, PolicyCheckpoint.STATE_SIZE), ('q', '<i4', number_actions)])
+        rows = np.empty(len(table), dtype=dtype)
+        if len(table) > 0:
+            rows['s'] = list(table.keys())
+            rows['q'] = list(table.values())
+        return rows
+
+    # ========== Recovery =====================================================
+
+    def recover(self):
+        """
+        Load the latest snapshot and replay the logs written after it into the policy.
+
+        Returns
+        -------
+        int
+            Number of replayed log records.
+
+        """
+        snapshots = self._files('snapshot')
+        snapshot_generation = 0
+        if len(snapshots) > 0:
+            snapshot_generation, file_name = snapshots[-1]
+            rows = np.load(file_name, allow_pickle=False)
+            for s, q in zip(rows['s'], rows['q']):
+                s = tuple(s.tolist())
+                for a in np.flatnonzero(q):
+                    self.policy.set_value(s, int(a), int(q[a]))
+
+        number_records = 0
+        for generation, file_name in self._files('log'):
+            if generation < snapshot_generation:
+                continue
+            data = np.fromfile(file_name, dtype=np.uint8)
+            length = len(data) - len(data) % PolicyCheckpoint.LOG_DTYPE.itemsize   # Ignore torn record
+            records = data[:length].view(PolicyCheckpoint.LOG_DTYPE)
+            for s, a, value in zip(records['s'].tolist(), records['a'].tolist(), records['value'].tolist()):
+                self.policy.set_value(tuple(s), a, value)
+            number_records += len(records)
+        return number_records
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    import random
+    import tempfile
+    from SamplePolicy import Policy
+    from PCubeAction import Action
+    from PCubeState import State
+
+    directory = tempfile.mkdtemp()
+    policy = Policy(len(Action))
+
+    # Train (random updates) with background checkpointing and one compaction
+    start_time_ns = time.perf_counter_ns()
+    with PolicyCheckpoint(policy, directory, flush_interval_s=0.1, compact_records=20_000) as checkpoint:
+        state = State()
+        for _ in range(50_000):
+            state = state.next_state(random.choice(list(Action)))
+            policy.add(state, random.choice(list(Action)), random.randint(1, 50))
+    print(f'Training with checkpoints: {(time.perf_counter_ns() - start_time_ns) / 1e9:.2f} s, '
+          f'{checkpoint.number_compactions} compaction(s)')
+
+    # Recover into a new policy
+    recovered = Policy(len(Action))
+    number_records = PolicyCheckpoint(recovered, directory).recover()
+    is_equal = (policy.Q.keys() == recovered.Q.keys()) and all((policy.Q[s] == recovered.Q[s]).all() for s in policy.Q)
+    print(f'Recovered {len(recovered.Q):_} states ({number_records:_} log records replayed): equal {is_equal}')
+    assert is_equal
+
+    # Recovery after compactions of a policy spilling entries to disk
+    directory = tempfile.mkdtemp()
+    policy = Policy(len(Action), max_entries=1_000, overflow='spill', spill_file=os.path.join(directory, 'policy.spill'))
+    with PolicyCheckpoint(policy, directory, flush_interval_s=60.0, compact_records=10**9) as checkpoint:
+        state = State()
+        for episode in range(5_000):
+            state = state.next_state(random.choice(list(Action)))
+            policy.add(state, random.choice(list(Action)), random.randint(1, 50))
+            if episode in (2_000, 4_000):
+                checkpoint.compact()
+    recovered = Policy(len(Action))
+    PolicyCheckpoint(recovered, directory).recover()
+    expected = policy.to_dict()
+    is_equal = (expected.keys() == recovered.Q.keys()) and all((expected[s] == recovered.Q[s]).all() for s in expected)
+    print(f'Recovered {len(recovered.Q):_} of {len(policy):_} states of a spilling policy '
+          f'({checkpoint.number_compactions} compactions): equal {is_equal}')
+    assert is_equal
@@ -2,19 +2,22 @@
 Basic example how to use the Pocket cube environment for OpenAI gym.
 
 Learns how to solve randomly scrambled cubes starting with cubes being
-scrambled by 1 move, then 2 moves, 3 moves, and so on. Finally, the results
+scrambled by 1 move, then 2 moves, 3 moves, and so on (episodes are
+scheduled by measured solve rates, refer to CurriculumScheduler). Finally, the results
 are visualized by trying to solve randomly scrambled cubes.
 
 @authors: Marc Hensel
 @contact: http://www.haw-hamburg.de/marc-hensel
 @copyright: 2023
-@version: 2023.08.21
+@version: 2026.10.18
 @license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
 """
 
-# Add Pocket cube env to path
+# Add Pocket cube env and common modules to path
+import os
 import sys
 sys.path.append('../../pocket_cube_gym')
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'common'))
 
 # Other imports
 import time
@@ -23,6 +26,10 @@ from PocketCubeEnv import PocketCubeEnv
 from PCubeAction import Action
 from PCubeState import State
 from SamplePolicy import Policy
+from PolicyCheckpoint import PolicyCheckpoint
+from TrainingProfiler import TrainingProfiler
+from MemoryStats import MemoryStats
+from CurriculumScheduler import CurriculumScheduler
 
 # -----------------------------------------------------------------------------
 # Agent
@@ -32,7 +39,8 @@ class SampleAgent():
     
     # ========== Constructor ==================================================
 
-    def __init__(self, render_mode='2D', render_fps=1.0):
+    def __init__(self, render_mode='2D', render_fps=1.0, report_interval_s=10.0, sampling_interval_s=None,
+                 max_table_entries=None, max_table_bytes=None, table_overflow='evict'):
         """
         Constructor.
 
@@ -42,6 +50,16 @@ class SampleAgent():
             '2D', '3D', or None. (Default: '2D')
         render_fps : float, optional
             Speed of the rendering in frames per seconds. (Default: metadata['render_fps'])
+        report_interval_s : float, optional
+            Time between training throughput reports in seconds (None: final report only). (Default: 10.0)
+        sampling_interval_s : float, optional
+            Interval of the sampling profiler in seconds (None: disabled). (Default: None)
+        max_table_entries : int, optional
+            Maximum number of policy entries in memory (None: unlimited). (Default: None)
+        max_table_bytes : int, optional
+            Maximum memory of the policy in bytes (None: unlimited). (Default: None)
+        table_overflow : string, optional
+            'evict' or 'spill' entries when a maximum is reached (refer to class Policy). (Default: 'evict')
 
         Returns
         -------
@@ -53,7 +71,15 @@ class SampleAgent():
         self.env = PocketCubeEnv(render_mode = render_mode, render_fps = render_fps)
         
         # Init policy
-        self.policy = Policy(self.env.action_space.n)
+        self.policy = Policy(self.env.action_space.n, max_table_entries, max_table_bytes, table_overflow)
+        self.memory = MemoryStats()
+        self.memory.register('policy', self.policy)
+
+        # Init training profiler (phases of train_policy() and table size)
+        self.profiler = TrainingProfiler(report_interval_s, sampling_interval_s)
+        self.profiler.gauge('table entries', lambda: f'{len(self.policy):>12_}')
+        self.profiler.gauge('table memory', lambda: f'{MemoryStats.format_bytes(self.memory.total_bytes()):>12}')
+        self.profiler.gauge('process memory', lambda: f'{MemoryStats.format_bytes(MemoryStats.process_bytes() or 0):>12}')
 
     # ========== Improve policy ===============================================
 
@@ -75,6 +101,7 @@ class SampleAgent():
         assert isinstance(state, State)
         
         # Skip if there is no known way to the solved cube from the state
+        self.profiler.count('lookups')
         if (self.policy.max_rewards(state) <= 0) and (state.is_cube_solved() is False):
             return
         
@@ -92,16 +119,19 @@ class SampleAgent():
                 self.env.observation_space = scrambled_state
                 new_state, reward, _, _, = self.env.step(action)
                 future_rewards[action.value] = reward + self.policy.max_rewards(new_state)
+            self.profiler.count('steps', 1 + len(actions))
+            self.profiler.count('lookups', len(actions))
 
             # Add action with highest future reward to Q tables
             max_reward = future_rewards.max()
             if max_reward > 0:
                 max_action = Action(future_rewards.argmax())
                 self.policy.add(scrambled_state, max_action, reward + max_reward)
+                self.profiler.count('updates')
 
     # -------------------------------------------------------------------------
 
-    def train_policy(self, number_scrambles, number_episodes):
+    def train_policy(self, number_scrambles, number_episodes, verbose=True):
         """
         Add state/action pairs for random states to the table.
         
@@ -116,29 +146,49 @@ class SampleAgent():
             Number of times the cube shall be rotated randomly.
         number_episodes : int
             Number of times trying to add a random state.
+        verbose : bool, optional
+            Print progress, throughput, and memory reports. (Default: True)
 
         Returns
         -------
         None.
         
         """
-        print(f'Training cube with {number_scrambles:_} scrambles:', flush=True)
+        if verbose:
+            print(f'Training cube with {number_scrambles:_} scrambles:', flush=True)
         start_time_ns = time.time_ns()
+        self.profiler.start()
         
         for current_episode in range(1, number_episodes + 1):
             # Scramble cube
-            self.env.reset()
-            self.env.scramble(number_scrambles - 1)     # For last scramble all actions are added below
+            number_entries = len(self.policy)
+            with self.profiler.phase('env.reset'):
+                self.env.reset()
+            with self.profiler.phase('env.scramble'):
+                self.env.scramble(number_scrambles - 1)     # For last scramble all actions are added below
+            self.profiler.count('steps', number_scrambles - 1)
             
             # Add last scramble (all actions)
-            self._add_scrambles(self.env.observation_space)
+            with self.profiler.phase('_add_scrambles'):
+                self._add_scrambles(self.env.observation_space)
+            self.profiler.count('new entries', len(self.policy) - number_entries)
+            self.profiler.count('episodes')
 
             # Print progress to the console
+            if not verbose:
+                continue
             if (current_episode % 1_000 == 0) or (current_episode == number_episodes):
                 time_per_episode_ns = (time.time_ns() - start_time_ns) / current_episode
                 print(f'\rRunning episode {current_episode:_} / {number_episodes:_} ({time_per_episode_ns / 1_000_000:.2f} ms/episode) ... ', flush=True, end = '')
             if current_episode == number_episodes:
                 print('ok')
+            elif self.profiler.report_if_due():
+                print()
+
+        self.profiler.stop()
+        if verbose:
+            self.profiler.report()
+            self.memory.report()
 
     # ========== Apply policy =================================================
     
@@ -155,7 +205,8 @@ class SampleAgent():
 
         Returns
         -------
-        None.
+        bool
+            True if the policy solved the cube, else False.
         
         """
         # Create the scrambled cube
@@ -177,6 +228,30 @@ class SampleAgent():
             if is_render:
                 self.env.render()
 
+        return self.env.observation_space.is_cube_solved()
+
+    # -------------------------------------------------------------------------
+
+    def solve_rate(self, number_scrambles, number_cubes):
+        """
+        Measure the share of scrambled cubes the policy solves (without rendering).
+
+        Parameters
+        ----------
+        number_scrambles : int
+            Number of times the cubes are randomly scrambled.
+        number_cubes : int
+            Number of cubes to scramble and solve.
+
+        Returns
+        -------
+        float
+            Solve rate in [0, 1].
+
+        """
+        number_solved = sum(self.apply_policy(number_scrambles, is_render=False) for _ in range(number_cubes))
+        return number_solved / number_cubes
+
 # -----------------------------------------------------------------------------
 # Main (sample)
 # -----------------------------------------------------------------------------
@@ -191,11 +266,20 @@ if __name__ == '__main__':
     else:
         print('No policy file found.')
     
-    # Improve policy for more scrambles and save it to file
-    # for number_scrambles in range(1, max_scrambles + 1):
-    #     agent.train_policy(number_scrambles, number_episodes = number_scrambles * 10_000)
+    # Improve policy for more scrambles (episodes towards depths not mastered yet) and save it to file
+    # scheduler = CurriculumScheduler(max_scrambles)
+    # train = lambda depth, number_episodes: agent.train_policy(depth, number_episodes, verbose=False)
+    # scheduler.run(train=train, evaluate=agent.solve_rate)
+    # print(f'Trained {scheduler.total_episodes():_} episodes {scheduler.episodes}')
+    # agent.memory.report()
     # print('Saving policy to file ...')
     # agent.policy.save_to_file()
+
+    # Alternative: incremental checkpoints written in the background while training
+    # checkpoint = PolicyCheckpoint(agent.policy)
+    # checkpoint.recover()
+    # with checkpoint:
+    #     scheduler.run(train=train, evaluate=agent.solve_rate)
     
     # Demonstrate policy with randomly scrambled cubes
     for number_scrambles in range(1, max_scrambles + 1):
@@ -4,20 +4,30 @@ Policy for basic example how to use the Pocket cube environment for OpenAI gym.
 The policy stores the 'quality' Q(s,a) being the maximum future rewards for
 action a applied to state s.
 
+The table grows with each new state. To limit its memory, a maximum number of
+entries and/or bytes can be configured. When the limit is reached, the oldest
+10 % of the entries are either evicted (dropped) or spilled to a file on disk
+(looked up there on misses). Reads never add entries to the table.
+
 @authors: Marc Hensel
 @contact: http://www.haw-hamburg.de/marc-hensel
 @copyright: 2023
-@version: 2023.08.09
+@version: 2026.10.18
 @license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
 """
-# Add Pocket cube env to path
+# Add Pocket cube env and common modules to path
+import os
 import sys
 sys.path.append('../../pocket_cube_gym')
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'common'))
 
 # Other imports
+import dbm
+import itertools
+import threading
 import numpy as np
-import os.path
 from collections import defaultdict
+from MemoryStats import MemoryStats
 from PCubeAction import Action
 from PCubeState import State
 
@@ -25,18 +35,48 @@ class Policy():
 
     # ========== Constructor ==================================================
 
-    def __init__(self, number_actions):
+    def __init__(self, number_actions, max_entries=None, max_bytes=None, overflow='evict', spill_file=None):
         """
         Constructor.
 
+        Parameters
+        ----------
+        number_actions : int
+            Number of actions (entries per state).
+        max_entries : int, optional
+            Maximum number of states kept in memory (None: unlimited). (Default: None)
+        max_bytes : int, optional
+            Maximum (estimated) memory of the table in bytes (None: unlimited). (Default: None)
+        overflow : string, optional
+            Behavior when a limit is reached: 'evict' drops the oldest entries,
+            'spill' moves them to spill_file. (Default: 'evict')
+        spill_file : string, optional
+            File to spill entries to. (Default: None, i.e., file_name + '.spill')
+
         Returns
         -------
         None.
-        
+
         """
+        assert overflow in ('evict', 'spill')
         self.Q = defaultdict(lambda: np.zeros(number_actions, dtype=int))
         self.file_name = 'PCube_SampleQuality.npy'
 
+        # Memory limits
+        self.max_entries = max_entries
+        self.max_bytes = max_bytes
+        self.overflow = overflow
+        self.spill_file = spill_file
+        self.evicted_entries = 0
+        self._spill = None
+        self._zeros = np.zeros(number_actions, dtype=int)
+        self._zeros.flags.writeable = False
+        self._entry_bytes = None
+        self._spill_lock = threading.RLock()        # Moves between memory and spill file vs. to_dict()
+
+        # Functions (s, a, future_rewards) called by add() (e.g., to log updates)
+        self.update_hooks = []
+
     # ========== Objects to table indices =====================================
     
     def to_index_s(self, state):
@@ -93,7 +133,7 @@ class Policy():
             
         """
         s = self.to_index_s(state)
-        return self.Q[s].max()
+        return self._get(s).max()
 
     # -------------------------------------------------------------------------
     
@@ -113,8 +153,31 @@ class Policy():
             
         """
         s = self.to_index_s(state)
-        return Action(self.Q[s].argmax())
-        
+        return Action(self._get(s).argmax())
+
+    # -------------------------------------------------------------------------
+
+    def _get(self, s):
+        """
+        Get the table row of index s without adding it (zeros if unknown).
+        """
+        q = self.Q.get(s)
+        if q is None:
+            if self._spill is not None:
+                value = self._spill.get(bytes(s))
+                if value is not None:
+                    return np.frombuffer(value, dtype=self._zeros.dtype)
+            return self._zeros
+        return q
+
+    # -------------------------------------------------------------------------
+
+    def __len__(self):
+        """
+        Get the number of states in the table (in memory and spilled to disk).
+        """
+        return len(self.Q) + (len(self._spill) if self._spill is not None else 0)
+
     # ========== Add (state, action) pair to table ============================
 
     def add(self, state, action, future_rewards):
@@ -139,21 +202,136 @@ class Policy():
         assert isinstance(action, Action)
         
         s = self.to_index_s(state)
-        a = self.to_index_a(action)        
+        a = self.to_index_a(action)
+        self.set_value(s, a, future_rewards)
+        for hook in self.update_hooks:
+            hook(s, a, future_rewards)
+
+    # -------------------------------------------------------------------------
+
+    def set_value(self, s, a, future_rewards):
+        """
+        Set the table entry Q[s][a] by indices (without calling update hooks).
+
+        Parameters
+        ----------
+        s : tuple
+            Index of the state (refer to to_index_s()).
+        a : int
+            Index of the action (refer to to_index_a()).
+        future_rewards : int
+            Reward and maximum future rewards when applying a to s.
+
+        Returns
+        -------
+        None.
+
+        """
+        if s not in self.Q:
+            # Move spilled entry back to memory
+            if self._spill is not None:
+                with self._spill_lock:
+                    key = bytes(s)
+                    value = self._spill.get(key)
+                    if value is not None:
+                        self.Q[s] = np.frombuffer(value, dtype=self._zeros.dtype).copy()
+                        del self._spill[key]
+            self._limit_memory()
         self.Q[s][a] = future_rewards
 
+    # ========== Memory limits ================================================
+
+    def _is_full(self):
+        """
+        Check if a new entry would exceed the maximum number of entries or bytes.
+        """
+        if (self.max_entries is not None) and (len(self.Q) >= self.max_entries):
+            return True
+        if self.max_bytes is not None:
+            if (self._entry_bytes is None) and (len(self.Q) >= 100):
+                self._entry_bytes = (MemoryStats.estimate_dict_bytes(self.Q) - sys.getsizeof(self.Q)) / len(self.Q)
+            entry_bytes = self._entry_bytes if self._entry_bytes is not None else 0
+            return sys.getsizeof(self.Q) + (len(self.Q) + 1) * entry_bytes > self.max_bytes
+        return False
+
+    # -------------------------------------------------------------------------
+
+    def _limit_memory(self):
+        """
+        Evict or spill the oldest 10 % of the entries if the table is full.
+
+        Returns
+        -------
+        None.
+
+        """
+        if not self._is_full():
+            return
+        number = max(1, len(self.Q) // 10)
+        keys = list(itertools.islice(self.Q.keys(), number))
+        if self.overflow == 'spill':
+            with self._spill_lock:
+                if self._spill is None:
+                    spill_file = self.file_name + '.spill' if self.spill_file is None else self.spill_file
+                    self._spill = dbm.open(spill_file, 'n')
+                for s in keys:
+                    self._spill[bytes(s)] = self.Q.pop(s).tobytes()
+        else:
+            for s in keys:
+                del self.Q[s]
+            self.evicted_entries += number
+
+    # -------------------------------------------------------------------------
+
+    def memory_stats(self):
+        """
+        Get memory statistics of the table (refer to class MemoryStats).
+        """
+        return {
+            'bytes': MemoryStats.estimate_dict_bytes(self.Q),
+            'entries': len(self.Q),
+            'max_entries': self.max_entries,
+            'max_bytes': self.max_bytes,
+            'spilled_entries': len(self._spill) if self._spill is not None else 0,
+            'evicted_entries': self.evicted_entries
+        }
+
     # ========== File I/O =====================================================
 
+    def to_dict(self):
+        """
+        Get a copy {s: Q[s]} of all entries in memory and spilled to disk.
+
+        Entries moved between memory and the spill file by another thread
+        are contained exactly once (e.g., for checkpoints while training).
+
+        Returns
+        -------
+        dict
+            Table rows by state index (rows in memory are not copied).
+
+        """
+        with self._spill_lock:
+            table = dict(self.Q)
+            if self._spill is not None:
+                for key in self._spill.keys():
+                    table[tuple(key)] = np.frombuffer(self._spill[key], dtype=self._zeros.dtype).copy()
+        return table
+
+    # -------------------------------------------------------------------------
+
     def save_to_file(self):
         """
         Save the table data to file 'PCube_SampleQuality.npy'.
 
+        Spilled entries are included, i.e., are loaded for saving.
+
         Returns
         -------
         None.
-        
+
         """
-        np.save(self.file_name, np.array(dict(self.Q)), allow_pickle= True)
+        np.save(self.file_name, np.array(self.to_dict()), allow_pickle= True)
 
     # -------------------------------------------------------------------------
 
@@ -169,7 +347,10 @@ class Policy():
         """
         if os.path.exists(self.file_name):
             q = np.load(self.file_name, allow_pickle = True)
-            self.Q.update(q.item())
+            for s, value in q.item().items():
+                if s not in self.Q:
+                    self._limit_memory()
+                self.Q[s] = value
             return True
         else:
             return False
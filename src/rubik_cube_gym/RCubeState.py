@@ -0,0 +1,664 @@
+"""
+States of Rubik's cubes (3x3x3) for OpenAI gym.
+
+The state engine models the 8 corner and 12 edge cubies of the cube. It uses
+the same actions (class Action) as the Pocket cube and provides the same API
+as the Pocket cube's class State. All moves are table-driven. Besides the
+object interface, the class provides vectorized operations on coordinates
+(i.e., small integers describing permutation and orientation of cubies) to
+back search and training with large batches of states.
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add Pocket cube env to path (shared actions)
+import os
+import sys
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'pocket_cube_gym'))
+
+# Other imports
+import itertools
+import numpy as np
+from PCubeAction import Action
+
+class State:
+    """
+    Representation of a Rubik's cube's states and related operations.
+
+    Each state contains of four tuples:
+    - corner_positions (8 items) stores which corner cubie is located at each corner slot.
+    - corner_orientations (8 items) stores the angle (0, 1, 2) of each corner at its slot.
+    - edge_positions (12 items) stores which edge cubie is located at each edge slot.
+    - edge_orientations (12 items) stores the flip (0, 1) of each edge at its slot.
+
+    Slots are indexed as follows (U: up, D: down, F: front, B: back, L: left, R: right):
+    - Corners: URF, UFL, ULB, UBR, DFR, DLF, DBL, DRB
+    - Edges: UR, UF, UL, UB, DR, DF, DL, DB, FR, FL, BL, BR
+
+    A solved cube has all cubies at their home slots with orientation 0. In
+    contrast to the Pocket cube, the center cubies of a Rubik's cube define the
+    cube's orientation, so that there is exactly one solved state. Face 'up'
+    is white and face 'front' is red.
+    """
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, corner_positions=tuple(range(8)), corner_orientations=tuple([0]*8),
+                 edge_positions=tuple(range(12)), edge_orientations=tuple([0]*12)):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        corner_positions : tuple(int), optional
+            Corner cubies at the 8 corner slots. (Default: solved cube)
+        corner_orientations : tuple(int), optional
+            Orientations of the 8 corner cubies. (Default: solved cube)
+        edge_positions : tuple(int), optional
+            Edge cubies at the 12 edge slots. (Default: solved cube)
+        edge_orientations : tuple(int), optional
+            Orientations of the 12 edge cubies. (Default: solved cube)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.corner_positions = corner_positions
+        self.corner_orientations = corner_orientations
+        self.edge_positions = edge_positions
+        self.edge_orientations = edge_orientations
+
+    # ========== Move definitions =============================================
+
+    # Clockwise quarter turns of the faces in 'is replaced by' notation:
+    # After the turn, slot i contains the cubie from slot permutation[i] and
+    # its orientation is increased by orientation[i].
+    __face_turns = {
+        'U': ((3, 0, 1, 2, 4, 5, 6, 7), (0, 0, 0, 0, 0, 0, 0, 0),
+              (3, 0, 1, 2, 4, 5, 6, 7, 8, 9, 10, 11), (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)),
+        'R': ((4, 1, 2, 0, 7, 5, 6, 3), (2, 0, 0, 1, 1, 0, 0, 2),
+              (8, 1, 2, 3, 11, 5, 6, 7, 4, 9, 10, 0), (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)),
+        'F': ((1, 5, 2, 3, 0, 4, 6, 7), (1, 2, 0, 0, 2, 1, 0, 0),
+              (0, 9, 2, 3, 4, 8, 6, 7, 1, 5, 10, 11), (0, 1, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0)),
+        'D': ((0, 1, 2, 3, 5, 6, 7, 4), (0, 0, 0, 0, 0, 0, 0, 0),
+              (0, 1, 2, 3, 5, 6, 7, 4, 8, 9, 10, 11), (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)),
+        'L': ((0, 2, 6, 3, 4, 1, 5, 7), (0, 1, 2, 0, 0, 2, 1, 0),
+              (0, 1, 10, 3, 4, 5, 9, 7, 8, 2, 6, 11), (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)),
+        'B': ((0, 1, 3, 7, 4, 5, 2, 6), (0, 0, 1, 2, 0, 0, 2, 1),
+              (0, 1, 2, 11, 4, 5, 6, 10, 8, 9, 3, 7), (0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 1))
+    }
+
+    # -------------------------------------------------------------------------
+
+    def _multiply(a, b):
+        """
+        Apply the cubie permutation b to the cubie permutation a.
+
+        Parameters
+        ----------
+        a : tuple
+            Tuple (corner_positions, corner_orientations, edge_positions, edge_orientations).
+        b : tuple
+            Tuple (corner_positions, corner_orientations, edge_positions, edge_orientations).
+
+        Returns
+        -------
+        tuple
+            Tuple (corner_positions, corner_orientations, edge_positions, edge_orientations).
+
+        """
+        cp = tuple(a[0][b[0][i]] for i in range(8))
+        co = tuple((a[1][b[0][i]] + b[1][i]) % 3 for i in range(8))
+        ep = tuple(a[2][b[2][i]] for i in range(12))
+        eo = tuple((a[3][b[2][i]] + b[3][i]) % 2 for i in range(12))
+        return cp, co, ep, eo
+
+    # -------------------------------------------------------------------------
+
+    def _create_action_tables():
+        """
+        Create the cubie permutations of all actions.
+
+        Returns
+        -------
+        dict
+            Key: Action, value: tuple (corner_positions, corner_orientations,
+            edge_positions, edge_orientations) of the action applied to the solved cube.
+
+        """
+        faces = { Action.R: 'R', Action.L: 'L', Action.U: 'U', Action.D: 'D', Action.F: 'F', Action.B: 'B' }
+        tables = {}
+        for action, face in faces.items():
+            turn = State.__face_turns[face]
+            tables[action] = turn
+            tables[action.inverse_action()] = State._multiply(State._multiply(turn, turn), turn)
+        return tables
+
+    # ========== Getter =======================================================
+
+    def is_cube_solved(self):
+        """
+        Check whether the state represents a solved cube (i.e., faces not scrambled).
+
+        Returns
+        -------
+        bool
+            True if state represents solved cube, else False.
+
+        """
+        return ((self.corner_positions == State.__solved[0]) and (self.corner_orientations == State.__solved[1])
+                and (self.edge_positions == State.__solved[2]) and (self.edge_orientations == State.__solved[3]))
+
+    # -------------------------------------------------------------------------
+
+    def __eq__(self, other):
+        return (isinstance(other, State) and (self.corner_positions == other.corner_positions)
+                and (self.corner_orientations == other.corner_orientations)
+                and (self.edge_positions == other.edge_positions)
+                and (self.edge_orientations == other.edge_orientations))
+
+    def __hash__(self):
+        return hash((self.corner_positions, self.corner_orientations, self.edge_positions, self.edge_orientations))
+
+    # ========== Apply action =================================================
+
+    def next_state(self, action):
+        """
+        Get state when a specific action is taken (i.e., a face rotated).
+
+        Parameters
+        ----------
+        action : Action
+            Action to take
+
+        Returns
+        -------
+        state  : State
+            Resulting state when the action is applied to the current state.
+
+        """
+        assert isinstance(action, Action)
+
+        cp, co, ep, eo = State.__action_tables[action]
+        positions, orientations = self.corner_positions, self.corner_orientations
+        new_corner_positions = tuple([positions[i] for i in cp])
+        new_corner_orientations = tuple([(orientations[i] + delta) % 3 for i, delta in zip(cp, co)])
+        positions, orientations = self.edge_positions, self.edge_orientations
+        new_edge_positions = tuple([positions[i] for i in ep])
+        new_edge_orientations = tuple([orientations[i] ^ delta for i, delta in zip(ep, eo)])
+
+        return State(new_corner_positions, new_corner_orientations, new_edge_positions, new_edge_orientations)
+
+    # ========== Plane representation =========================================
+
+    # Facelets of the corner and edge slots. Faces are indexed in the order
+    # of get_plane_representation() (U, L, B, F, R, D), facelets row by row.
+    __corner_facelets = (
+        ((0, 8), (4, 0), (3, 2)),       # URF
+        ((0, 6), (3, 0), (1, 2)),       # UFL
+        ((0, 0), (1, 0), (2, 2)),       # ULB
+        ((0, 2), (2, 0), (4, 2)),       # UBR
+        ((5, 2), (3, 8), (4, 6)),       # DFR
+        ((5, 0), (1, 8), (3, 6)),       # DLF
+        ((5, 6), (2, 8), (1, 6)),       # DBL
+        ((5, 8), (4, 8), (2, 6))        # DRB
+    )
+    __edge_facelets = (
+        ((0, 5), (4, 1)),               # UR
+        ((0, 7), (3, 1)),               # UF
+        ((0, 3), (1, 1)),               # UL
+        ((0, 1), (2, 1)),               # UB
+        ((5, 5), (4, 7)),               # DR
+        ((5, 1), (3, 7)),               # DF
+        ((5, 3), (1, 7)),               # DL
+        ((5, 7), (2, 7)),               # DB
+        ((3, 5), (4, 3)),               # FR
+        ((3, 3), (1, 5)),               # FL
+        ((2, 5), (1, 3)),               # BL
+        ((2, 3), (4, 5))                # BR
+    )
+
+    # Cubie colors of solved state
+    __corner_colors = (
+        ('W', 'B', 'R'), ('W', 'R', 'G'), ('W', 'G', 'O'), ('W', 'O', 'B'),
+        ('Y', 'R', 'B'), ('Y', 'G', 'R'), ('Y', 'O', 'G'), ('Y', 'B', 'O'))
+    __edge_colors = (
+        ('W', 'B'), ('W', 'R'), ('W', 'G'), ('W', 'O'), ('Y', 'B'), ('Y', 'R'),
+        ('Y', 'G'), ('Y', 'O'), ('R', 'B'), ('R', 'G'), ('O', 'G'), ('O', 'B'))
+    __center_colors = ('W', 'G', 'O', 'R', 'B', 'Y')
+
+    def get_plane_representation(self):
+        """
+        Get a plane representation of the state.
+
+        The plane representation is defined as follows:
+
+                    +-------+
+                    | U U U |
+                    | U U U |
+                    | U U U |
+            +-------+-------+-------+-------+
+            | L L L | F F F | R R R | B B B |
+            | L L L | F F F | R R R | B B B |
+            | L L L | F F F | R R R | B B B |
+            +-------+-------+-------+-------+
+                    | D D D |
+                    | D D D |
+                    | D D D |
+                    +-------+
+
+        Data structure stores the cube's faces in the same order as the
+        Pocket cube's plane representation (U, L, B, F, R, D), each face
+        with 9 facelets row by row.
+
+        Returns
+        -------
+        list(list(char)) :
+            Plane representation with colors denoted by chars.
+
+        """
+        plane_faces = [[color] * 9 for color in State.__center_colors]
+
+        for slot, (corner, orientation) in enumerate(zip(self.corner_positions, self.corner_orientations)):
+            colors = State.__corner_colors[corner]
+            for n in range(3):
+                face_index, location_index = State.__corner_facelets[slot][(n + orientation) % 3]
+                plane_faces[face_index][location_index] = colors[n]
+
+        for slot, (edge, orientation) in enumerate(zip(self.edge_positions, self.edge_orientations)):
+            colors = State.__edge_colors[edge]
+            for n in range(2):
+                face_index, location_index = State.__edge_facelets[slot][(n + orientation) % 2]
+                plane_faces[face_index][location_index] = colors[n]
+
+        return plane_faces
+
+    # ========== One-hot encoding =============================================
+
+    def one_hot_encoding(self, dst=None):
+        """
+        Encode as one-hot encoding of the cube's state as 20x24 tensor.
+
+        The encoding is used for the training of neural networks.
+        Each of the 8 corner cubies (rows 0 to 7) and 12 edge cubies (rows
+        8 to 19) is encoded as 24 numbers, where only one has the value 1 and
+        all others 0. The index [0..23] of the value 1 is determined by:
+
+            3 * <slot of the corner> + <orientation of the corner>
+            2 * <slot of the edge> + <orientation of the edge>
+
+        Parameters
+        ----------
+        dst : numpy.ndarray of shape (20,24) or None
+            Numpy array to store encoding in or None to create an array.
+            (Default: None)
+
+        Returns
+        -------
+        numpy.ndarray
+            Encoded state
+
+        """
+        assert (dst is None) or (isinstance(dst, np.ndarray) and (dst.shape == (20, 24)))
+
+        # Create data structure
+        if dst is None:
+            dst = np.zeros((20, 24))
+
+        # Create one-hot encoded vector for each cubie
+        for slot, (corner, orientation) in enumerate(zip(self.corner_positions, self.corner_orientations)):
+            dst[corner, 3 * slot + orientation] = 1
+        for slot, (edge, orientation) in enumerate(zip(self.edge_positions, self.edge_orientations)):
+            dst[8 + edge, 2 * slot + orientation] = 1
+
+        return dst
+
+    # -------------------------------------------------------------------------
+
+    def one_hot_encode_states(states):
+        """
+        Encode multiple cube states as 20x24 one-hot tensors.
+
+        Refer to one_hot_encoding() for further information on the encoding.
+
+        Parameters
+        ----------
+        states: list(State) or list(list(State))
+            List of cube states from type State
+
+        Returns
+        -------
+        numpy.ndarray
+            Array of encoded states
+
+        """
+        encoded_shape = (20, 24)
+
+        # states could be list of lists or just list of states
+        if isinstance(states[0], list):
+            encoded = np.zeros((len(states), len(states[0])) + encoded_shape, dtype=np.float32)
+            for i, st_list in enumerate(states):
+                for j, state in enumerate(st_list):
+                    state.one_hot_encoding(dst = encoded[i, j])
+        else:
+            encoded = np.zeros((len(states), ) + encoded_shape, dtype=np.float32)
+            for i, state in enumerate(states):
+                state.one_hot_encoding(dst = encoded[i])
+
+        return encoded
+
+    # ========== Coordinates ==================================================
+
+    # Number of values of each coordinate:
+    # - Corner orientations (3^7), edge orientations (2^11), corner permutation (8!)
+    # - Slots of the edge groups UR-UB, DR-DB, and FR-BR (12 * 11 * 10 * 9)
+    NUMBER_COORDINATES = 6
+    COORDINATE_SIZES = (2187, 2048, 40320, 11880, 11880, 11880)
+
+    def get_coordinates(self):
+        """
+        Get the coordinates describing the state.
+
+        Returns
+        -------
+        tuple(int)
+            Corner orientation, edge orientation, corner permutation, and
+            the permutation coordinates of the edge groups 0-3, 4-7, and 8-11.
+
+        """
+        twist = 0
+        for orientation in self.corner_orientations[:7]:
+            twist = 3 * twist + orientation
+        flip = 0
+        for orientation in self.edge_orientations[:11]:
+            flip = 2 * flip + orientation
+        corner_permutation = State._rank_permutation(self.corner_positions)
+
+        edge_slots = [0] * 12
+        for slot, edge in enumerate(self.edge_positions):
+            edge_slots[edge] = slot
+        edge_groups = tuple(State._rank_slots(edge_slots[4 * g:4 * g + 4]) for g in range(3))
+
+        return (twist, flip, corner_permutation) + edge_groups
+
+    # -------------------------------------------------------------------------
+
+    def from_coordinates(coordinates):
+        """
+        Create the state described by coordinates.
+
+        Parameters
+        ----------
+        coordinates : tuple(int)
+            Coordinates as returned by get_coordinates().
+
+        Returns
+        -------
+        State
+            State described by the coordinates.
+
+        """
+        twist, flip, corner_permutation = coordinates[:3]
+
+        corner_orientations = [0] * 8
+        for i in range(6, -1, -1):
+            twist, corner_orientations[i] = divmod(twist, 3)
+        corner_orientations[7] = (-sum(corner_orientations)) % 3
+        edge_orientations = [0] * 12
+        for i in range(10, -1, -1):
+            flip, edge_orientations[i] = divmod(flip, 2)
+        edge_orientations[11] = sum(edge_orientations) % 2
+
+        corner_positions = State._unrank_permutation(corner_permutation, 8)
+        edge_positions = [0] * 12
+        for g in range(3):
+            for k, slot in enumerate(State._unrank_slots(coordinates[3 + g])):
+                edge_positions[slot] = 4 * g + k
+
+        return State(tuple(corner_positions), tuple(corner_orientations),
+                     tuple(edge_positions), tuple(edge_orientations))
+
+    # -------------------------------------------------------------------------
+
+    def _rank_permutation(permutation):
+        """
+        Lehmer rank of a permutation (0 for the identity).
+        """
+        rank, n = 0, len(permutation)
+        for i in range(n - 1):
+            smaller = sum(1 for j in range(i + 1, n) if permutation[j] < permutation[i])
+            rank = rank * (n - i) + smaller
+        return rank
+
+    def _unrank_permutation(rank, n):
+        """
+        Permutation of range(n) with the Lehmer rank 'rank'.
+        """
+        digits = []
+        for base in range(1, n + 1):
+            rank, digit = divmod(rank, base)
+            digits.append(digit)
+        available = list(range(n))
+        return [available.pop(digit) for digit in reversed(digits)]
+
+    def _rank_slots(slots):
+        """
+        Rank of the ordered slots (4 out of 12) of an edge group.
+        """
+        available = list(range(12))
+        rank = 0
+        for slot in slots:
+            index = available.index(slot)
+            rank = rank * len(available) + index
+            available.pop(index)
+        return rank
+
+    def _unrank_slots(rank):
+        """
+        Ordered slots (4 out of 12) of an edge group with the rank 'rank'.
+        """
+        indices = []
+        for base in (9, 10, 11, 12):
+            rank, index = divmod(rank, base)
+            indices.append(index)
+        available = list(range(12))
+        return [available.pop(index) for index in reversed(indices)]
+
+    # ========== Vectorized coordinate moves ==================================
+
+    def _create_coordinate_tables():
+        """
+        Create the move tables of all coordinates.
+
+        The tables are flat arrays indexed by <coordinate> * 12 + <action value>.
+
+        Returns
+        -------
+        tuple(numpy.ndarray)
+            Move tables (int32) in the order of the coordinates.
+
+        """
+        actions = list(Action)
+        number_actions = len(actions)
+        tables = []
+
+        # Orientations: decode all values, apply action, and encode
+        for size, number_digits, modulo, index in ((2187, 7, 3, 1), (2048, 11, 2, 3)):
+            values = np.arange(size)
+            digits = np.zeros((size, number_digits + 1), dtype=np.int64)
+            for i in range(number_digits - 1, -1, -1):
+                values, digits[:, i] = np.divmod(values, modulo)
+            digits[:, number_digits] = (-digits.sum(axis=1)) % modulo
+            table = np.zeros((size, number_actions), dtype=np.int32)
+            for action in actions:
+                permutation = np.array(State.__action_tables[action][index - 1])
+                delta = np.array(State.__action_tables[action][index])
+                moved = (digits[:, permutation] + delta) % modulo
+                weights = modulo ** np.arange(number_digits - 1, -1, -1)
+                table[:, action.value] = moved[:, :number_digits] @ weights
+            tables.append(table)
+
+        # Corner permutation: rank all 8! permutations in lexicographic order
+        permutations = np.array(list(itertools.permutations(range(8))), dtype=np.int64)
+        table = np.zeros((len(permutations), number_actions), dtype=np.int32)
+        for action in actions:
+            moved = permutations[:, np.array(State.__action_tables[action][0])]
+            table[:, action.value] = State._rank_permutations(moved)
+        tables.append(table)
+
+        # Edge groups: slot i is replaced by slot permutation[i], i.e., a cubie moves from slot permutation[i] to i
+        slots = np.array(list(itertools.permutations(range(12), 4)), dtype=np.int64)
+        table = np.zeros((len(slots), number_actions), dtype=np.int32)
+        for action in actions:
+            destination = np.argsort(np.array(State.__action_tables[action][2]))
+            table[:, action.value] = State._rank_slot_arrays(destination[slots])
+        tables += [table] * 3
+
+        return tuple(np.ascontiguousarray(table.ravel()) for table in tables)
+
+    # -------------------------------------------------------------------------
+
+    def _rank_permutations(permutations):
+        """
+        Vectorized Lehmer ranks of permutations (array of shape (N, n)).
+        """
+        n = permutations.shape[1]
+        ranks = np.zeros(len(permutations), dtype=np.int64)
+        for i in range(n - 1):
+            smaller = (permutations[:, i + 1:] < permutations[:, i:i + 1]).sum(axis=1)
+            ranks = ranks * (n - i) + smaller
+        return ranks
+
+    def _rank_slot_arrays(slots):
+        """
+        Vectorized ranks of ordered edge group slots (array of shape (N, 4)).
+        """
+        ranks = np.zeros(len(slots), dtype=np.int64)
+        for k in range(4):
+            smaller_used = (slots[:, :k] < slots[:, k:k + 1]).sum(axis=1)
+            ranks = ranks * (12 - k) + slots[:, k] - smaller_used
+        return ranks
+
+    # -------------------------------------------------------------------------
+
+    def next_coordinates(coordinates, actions, out=None):
+        """
+        Apply actions to a batch of states given by their coordinates.
+
+        Each move costs one table lookup per coordinate. Coordinates are
+        stored as array of shape (6, N), so that each coordinate of all
+        states is a contiguous row.
+
+        Parameters
+        ----------
+        coordinates : numpy.ndarray of shape (6, N) and dtype int32
+            Coordinates of N states (refer to get_coordinates()).
+        actions : numpy.ndarray of shape (N,) or int
+            Action values in [0, 11] to apply to the states.
+        out : numpy.ndarray of shape (6, N) or None
+            Array to store the new coordinates in (may be coordinates). (Default: None)
+
+        Returns
+        -------
+        numpy.ndarray of shape (6, N)
+            Coordinates of the resulting states.
+
+        """
+        if out is None:
+            out = np.empty_like(coordinates)
+        for table, src, dst in zip(State.__coordinate_tables, coordinates, out):
+            np.take(table, src * 12 + actions, out=dst)
+        return out
+
+    # -------------------------------------------------------------------------
+
+    def successor_coordinates(coordinates):
+        """
+        Apply all 12 actions to a batch of states given by their coordinates.
+
+        Parameters
+        ----------
+        coordinates : numpy.ndarray of shape (6, N) and dtype int32
+            Coordinates of N states.
+
+        Returns
+        -------
+        numpy.ndarray of shape (6, N, 12)
+            Coordinates of the successors, indexed by state and action value.
+
+        """
+        successors = np.empty(coordinates.shape + (12,), dtype=coordinates.dtype)
+        for table, src, dst in zip(State.__coordinate_tables, coordinates, successors):
+            dst[:] = table.reshape(-1, 12)[src]
+        return successors
+
+    # -------------------------------------------------------------------------
+
+    def are_solved_coordinates(coordinates):
+        """
+        Check which states of a batch given by coordinates are solved.
+
+        Parameters
+        ----------
+        coordinates : numpy.ndarray of shape (6, ...)
+            Coordinates of states.
+
+        Returns
+        -------
+        numpy.ndarray of bool
+            True for each solved state, else False.
+
+        """
+        solved = coordinates[0] == State.SOLVED_COORDINATES[0]
+        for row, value in zip(coordinates[1:], State.SOLVED_COORDINATES[1:]):
+            solved &= (row == value)
+        return solved
+
+    # -------------------------------------------------------------------------
+
+    def to_coordinate_array(states):
+        """
+        Get the coordinates of multiple states as array of shape (6, N).
+        """
+        return np.array([state.get_coordinates() for state in states], dtype=np.int32).reshape(-1, 6).T.copy()
+
+    def from_coordinate_array(coordinates):
+        """
+        Get the states of a coordinate array of shape (6, N) as list(State).
+        """
+        return [State.from_coordinates(tuple(int(c) for c in column)) for column in coordinates.T]
+
+# ========== Class-level tables (require the class to be defined) =============
+
+State._State__solved = (tuple(range(8)), tuple([0]*8), tuple(range(12)), tuple([0]*12))
+State._State__action_tables = State._create_action_tables()
+State._State__coordinate_tables = State._create_coordinate_tables()
+State.SOLVED_COORDINATES = State().get_coordinates()
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    import time
+
+    # Object interface: apply sample actions and revert them
+    state = State()
+    for action in [Action.R, Action.U, Action.r, Action.u]:
+        state = state.next_state(action)
+    print('Plane representation after R U r u:', state.get_plane_representation())
+
+    # Vectorized interface: random moves on a batch of coordinates (sized to stay in cache)
+    number_states, number_moves = 65_536, 100
+    coordinates = np.tile(np.array(State.SOLVED_COORDINATES, dtype=np.int32)[:, None], (1, number_states))
+    actions = np.random.randint(0, 12, size=(number_moves, number_states), dtype=np.int32)
+    start_time_ns = time.time_ns()
+    for move_actions in actions:
+        State.next_coordinates(coordinates, move_actions, out=coordinates)
+    elapsed_s = (time.time_ns() - start_time_ns) / 1e9
+    print(f'{number_states * number_moves / elapsed_s / 1e6:.1f} million moves/s')
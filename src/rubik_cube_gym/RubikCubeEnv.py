@@ -0,0 +1,395 @@
+"""
+OpenAI gym environment for Rubik's cubes (3x3x3).
+
+The environment provides the same API as the Pocket cube environment
+(PocketCubeEnv) for a single cube. Additionally, it steps batches of cubes
+in lockstep. Batches are represented by coordinate arrays of shape (6, N)
+(refer to class State), so that a move of all cubes in the batch costs one
+vectorized table lookup per coordinate.
+
+The environment follows the gym documentation (last visited: 03.08.2023):
+https://www.gymlibrary.dev/content/environment_creation/
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add Pocket cube env to path (shared actions and rendering)
+import os
+import sys
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'pocket_cube_gym'))
+
+# Other imports
+import gym
+from gym import spaces
+import random
+import numpy as np
+
+from PCubeAction import Action
+from RCubeState import State
+
+# -----------------------------------------------------------------------------
+# Environment
+# -----------------------------------------------------------------------------
+
+class RubikCubeEnv(gym.Env):
+    # Define render modes ('None' included by default) and speed
+    metadata = {'render_modes': ['2D'], 'render_fps': 1.0}
+
+    # Rewards (same as Pocket cube environment)
+    REWARD_SOLVED = 50
+    REWARD_MOVE = -1
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, render_mode='2D', render_fps=None, batch_size=0):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        render_mode : string, optional
+            '2D' or None. (Default: '2D')
+        render_fps : float
+            Speed of the rendering in frames per seconds. (Default: metadata['render_fps'])
+        batch_size : int, optional
+            Number of cubes stepped in lockstep by the batch methods (0: no batch). (Default: 0)
+
+        Returns
+        -------
+        None.
+
+        """
+        # Init action space (6 faces rotated clockwise or counter-clockwise)
+        self.action_space = spaces.Discrete(12)
+
+        # Observation space (will be initialized as solved cube)
+        self.observation_space = None
+
+        # Init rendering
+        assert render_mode is None or render_mode in self.metadata['render_modes']
+        assert render_fps is None or isinstance(render_fps, float)
+
+        self.render_mode = render_mode
+        if render_fps is None:
+            render_fps = self.metadata['render_fps']
+
+        if render_mode == '2D':
+            from PCubeRender2D import Render2D
+            self.render_window = Render2D(self, render_fps, cube_size=3)
+
+        # Set initial state (single cube and batch)
+        self.observation_space, _ = self.reset()
+        self.reset_batch(batch_size)
+
+    # ========== Override gym.Env: Reset environment ==========================
+
+    def reset(self):
+        """
+        Sets the environment to its initial state.
+
+        In contrast to Pocket cubes, the center cubies define the orientation
+        of a Rubik's cube. Hence, there is no random orientation of the cube.
+
+        Returns
+        -------
+        state: State
+            Initial state (observation space) of the cube
+        info:
+            Empty, but required by Gym API
+
+        """
+        self.last_action = None
+        self.number_actions = 0
+        self.number_scrambles = 0
+
+        self.observation_space = State()
+
+        return self.observation_space, {}
+
+    # ========== Override gym.Env: Do action (time step) ======================
+
+    def step(self, action):
+        """
+        Do an action resulting in new state and reward.
+
+        Parameters
+        ----------
+        action : Action
+            Action to take.
+
+        Returns
+        -------
+        next_state : State
+            New state after the action was taken
+        reward : int
+            Reward of the action in the current state (50 if cube is solved, else -1)
+        done : bool
+            True if the cube is in the solved state, else False
+        info:
+            Empty, but required by Gym API
+
+        """
+        assert isinstance(action, Action)
+
+        # Apply action to current state
+        next_state = self.observation_space.next_state(action)
+        self.observation_space = next_state
+
+        # Check for end state and determine reward
+        done = next_state.is_cube_solved()
+        reward = RubikCubeEnv.REWARD_SOLVED if done else RubikCubeEnv.REWARD_MOVE
+
+        # Store last and overall number of actions (i.e., rotations)
+        self.last_action = action
+        self.number_actions += 1
+
+        return next_state, reward, done, {}
+
+    # ========== Override gym.Env: Render =====================================
+
+    def render(self, state=None):
+        """
+        Display a cube state.
+
+        Parameters
+        ----------
+        state  : State
+            State to be displayed.
+            By default (None), this is the internal state in self.observation_space.
+
+        Returns
+        -------
+        None.
+
+        """
+        if state is None:
+            state = self.observation_space
+        if self.render_mode == '2D':
+            self.render_window.render(state)
+
+    # ========== Close resources ==============================================
+
+    def close(self):
+        """
+        Closes PyGame resources (opened for rendering).
+
+        Returns
+        -------
+        None.
+
+        """
+        if (self.render_mode == '2D') and (self.render_window is not None):
+            self.render_window.close()
+
+    # ========== Scramble cube (i.e., apply random rotations) =================
+
+    def scramble(self, number_moves):
+        """
+        Apply random sequence of actions to cube state.
+
+        Parameters
+        ----------
+        number_moves : int
+            Number of rotations to apply
+
+        Returns
+        -------
+        State
+            State after scrambling
+
+        """
+        # Apply random actions (excluding inverse sequences like Rr or uU)
+        action = None
+        for _ in range(number_moves):
+            valid_actions = list(Action)
+            if action is not None:
+                valid_actions.remove(action.inverse_action())
+            action = random.choice(valid_actions)
+            self.observation_space = self.observation_space.next_state(action)
+
+        # Store number of scrambles (displayed in rendering) and don't count moves
+        self.number_scrambles = number_moves
+        self.number_actions = 0
+        self.last_action = None
+
+        return self.observation_space
+
+    # ========== Explore all next states of a given state =====================
+
+    def explore_state(self, state=None, encoded=True):
+        """
+        Expand cube state by applying every action to it.
+
+        Parameters
+        ----------
+        state : State
+            State to explore.
+            By default (None) the current state is explored.
+        encoded : bool
+            Return state in encoded format (20x24 Tensor in one-hot-encoding)
+
+        Returns
+        -------
+        new_states : list(State) or numpy.ndarray of shape (12, 20, 24)
+            States that can be reached from the original state.
+        is_solved_states : list(bool)
+            Corresponding flag, if a state in the list is the solved cube.
+
+        """
+        assert (state is None) or isinstance(state, State)
+
+        explored_state = self.observation_space if (state is None) else state
+        new_states = [explored_state.next_state(action) for action in Action]
+        is_solved_states = [new_state.is_cube_solved() for new_state in new_states]
+        if encoded is True:
+            new_states = State.one_hot_encode_states(new_states)
+
+        return new_states, is_solved_states
+
+    # ========== Batch of cubes ===============================================
+
+    def reset_batch(self, batch_size):
+        """
+        Set all cubes of the batch to the solved state.
+
+        Parameters
+        ----------
+        batch_size : int
+            Number of cubes in the batch.
+
+        Returns
+        -------
+        numpy.ndarray of shape (6, batch_size)
+            Coordinates of the cubes.
+
+        """
+        solved = np.array(State.SOLVED_COORDINATES, dtype=np.int32)
+        self.batch_coordinates = np.tile(solved[:, None], (1, batch_size))
+        self.batch_last_actions = np.full(batch_size, -1, dtype=np.int32)
+        self.batch_number_actions = np.zeros(batch_size, dtype=np.int32)
+        return self.batch_coordinates
+
+    # -------------------------------------------------------------------------
+
+    def step_batch(self, actions):
+        """
+        Apply one action to each cube of the batch.
+
+        Parameters
+        ----------
+        actions : numpy.ndarray of shape (batch_size,)
+            Action values in [0, 11].
+
+        Returns
+        -------
+        coordinates : numpy.ndarray of shape (6, batch_size)
+            Coordinates of the new states (updated in place).
+        rewards : numpy.ndarray of shape (batch_size,)
+            Rewards of the actions.
+        dones : numpy.ndarray of shape (batch_size,)
+            True for cubes in the solved state.
+
+        """
+        actions = np.asarray(actions, dtype=np.int32)
+        State.next_coordinates(self.batch_coordinates, actions, out=self.batch_coordinates)
+        dones = State.are_solved_coordinates(self.batch_coordinates)
+        rewards = np.where(dones, RubikCubeEnv.REWARD_SOLVED, RubikCubeEnv.REWARD_MOVE)
+
+        self.batch_last_actions[:] = actions
+        self.batch_number_actions += 1
+
+        return self.batch_coordinates, rewards, dones
+
+    # -------------------------------------------------------------------------
+
+    def scramble_batch(self, number_moves):
+        """
+        Apply random sequences of actions to all cubes of the batch.
+
+        Inverse sequences (like Rr or uU) are excluded by drawing each action
+        from the 11 actions that do not undo the previous one.
+
+        Parameters
+        ----------
+        number_moves : int or numpy.ndarray of shape (batch_size,)
+            Number of rotations to apply (same for all cubes or per cube).
+
+        Returns
+        -------
+        numpy.ndarray of shape (6, batch_size)
+            Coordinates of the scrambled cubes.
+
+        """
+        batch_size = self.batch_coordinates.shape[1]
+        number_moves = np.broadcast_to(np.asarray(number_moves), (batch_size,))
+        inverse = np.array([Action(a).inverse_action().value for a in range(12)], dtype=np.int32)
+
+        last_actions = np.full(batch_size, -1, dtype=np.int32)
+        for move in range(int(number_moves.max(initial=0))):
+            # Random action different from the inverse of the last action
+            actions = np.random.randint(0, 11, size=batch_size).astype(np.int32)
+            has_last = last_actions >= 0
+            blocked = inverse[np.maximum(last_actions, 0)]
+            actions += has_last & (actions >= blocked)
+
+            # Apply to cubes with remaining scramble moves only
+            is_active = move < number_moves
+            moved = State.next_coordinates(self.batch_coordinates, actions)
+            self.batch_coordinates[:, is_active] = moved[:, is_active]
+            last_actions = np.where(is_active, actions, last_actions)
+
+        self.batch_last_actions[:] = -1
+        self.batch_number_actions[:] = 0
+        return self.batch_coordinates
+
+    # -------------------------------------------------------------------------
+
+    def explore_batch(self, coordinates=None):
+        """
+        Expand all cubes of a batch by applying every action to them.
+
+        Parameters
+        ----------
+        coordinates : numpy.ndarray of shape (6, N), optional
+            Coordinates of the states to explore. (Default: the environment's batch)
+
+        Returns
+        -------
+        new_coordinates : numpy.ndarray of shape (6, N, 12)
+            Coordinates of the successors, indexed by state and action value.
+        is_solved_states : numpy.ndarray of shape (N, 12)
+            True for successors being the solved cube.
+
+        """
+        if coordinates is None:
+            coordinates = self.batch_coordinates
+        new_coordinates = State.successor_coordinates(coordinates)
+        return new_coordinates, State.are_solved_coordinates(new_coordinates)
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    import time
+
+    # Step a batch of cubes with random actions
+    env = RubikCubeEnv(render_mode=None, batch_size=65_536)
+    env.scramble_batch(20)
+    start_time_ns = time.time_ns()
+    for _ in range(100):
+        env.step_batch(np.random.randint(0, 12, size=65_536))
+    elapsed_s = (time.time_ns() - start_time_ns) / 1e9
+    print(f'Batch stepping: {100 * 65_536 / elapsed_s / 1e6:.1f} million steps/s')
+
+    # Run sample action rendering in 2D
+    env = RubikCubeEnv(render_mode='2D', render_fps=1.5)
+    env.render()
+    for action in [Action.F, Action.L, Action.u, Action.U, Action.l, Action.f]:
+        env.step(action)
+        env.render()
+    env.close()
@@ -0,0 +1,283 @@
+"""
+Cubie and coordinate representation of Rubik's cubes for the two-phase solver.
+
+The two-phase algorithm (H. Kociemba) uses its own set of 18 moves (quarter
+and half turns) and of coordinates:
+
+- Phase 1 reduces the cube to the subgroup <U, D, R2, L2, F2, B2>. It is
+  described by the corner orientations (twist), the edge orientations (flip),
+  and the unordered slots of the four UD-slice edges FR, FL, BL, BR (slice).
+- Phase 2 solves the cube within the subgroup. It is described by the
+  corner permutation, the permutation of the 8 edges in the U and D layers,
+  and the permutation of the 4 UD-slice edges.
+
+Cubies and slots are indexed as in the Rubik's cube gym (class State):
+- Corners: URF, UFL, ULB, UBR, DFR, DLF, DBL, DRB
+- Edges: UR, UF, UL, UB, DR, DF, DL, DB, FR, FL, BL, BR
+
+All coordinate functions are vectorized, i.e., they work on arrays with one
+cube per row. They are used to generate move and pruning tables.
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+import itertools
+import numpy as np
+
+class CubieCube:
+    """
+    Cube on cubie level (permutation and orientation of corners and edges).
+    """
+
+    # ========== Moves ========================================================
+
+    # Faces in the order used by the move indices: move = 3 * face + power,
+    # with power 0 (90 degrees clockwise), 1 (180 degrees), 2 (90 degrees counter-clockwise)
+    FACES = ('U', 'R', 'F', 'D', 'L', 'B')
+    NUMBER_MOVES = 18
+    MOVE_NAMES = tuple(face + suffix for face in FACES for suffix in ('', '2', "'"))
+
+    # Moves of phase 2 (subgroup <U, D, R2, L2, F2, B2>)
+    PHASE2_MOVES = (0, 1, 2, 4, 7, 9, 10, 11, 13, 16)
+
+    # Clockwise quarter turns in 'is replaced by' notation (cp, co, ep, eo)
+    __face_turns = (
+        ((3, 0, 1, 2, 4, 5, 6, 7), (0, 0, 0, 0, 0, 0, 0, 0),
+         (3, 0, 1, 2, 4, 5, 6, 7, 8, 9, 10, 11), (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)),
+        ((4, 1, 2, 0, 7, 5, 6, 3), (2, 0, 0, 1, 1, 0, 0, 2),
+         (8, 1, 2, 3, 11, 5, 6, 7, 4, 9, 10, 0), (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)),
+        ((1, 5, 2, 3, 0, 4, 6, 7), (1, 2, 0, 0, 2, 1, 0, 0),
+         (0, 9, 2, 3, 4, 8, 6, 7, 1, 5, 10, 11), (0, 1, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0)),
+        ((0, 1, 2, 3, 5, 6, 7, 4), (0, 0, 0, 0, 0, 0, 0, 0),
+         (0, 1, 2, 3, 5, 6, 7, 4, 8, 9, 10, 11), (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)),
+        ((0, 2, 6, 3, 4, 1, 5, 7), (0, 1, 2, 0, 0, 2, 1, 0),
+         (0, 1, 10, 3, 4, 5, 9, 7, 8, 2, 6, 11), (0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0)),
+        ((0, 1, 3, 7, 4, 5, 2, 6), (0, 0, 1, 2, 0, 0, 2, 1),
+         (0, 1, 2, 11, 4, 5, 6, 10, 8, 9, 3, 7), (0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 1))
+    )
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, cp=tuple(range(8)), co=tuple([0]*8), ep=tuple(range(12)), eo=tuple([0]*12)):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        cp : tuple(int), optional
+            Corner cubies at the 8 corner slots. (Default: solved cube)
+        co : tuple(int), optional
+            Orientations of the corners at the 8 slots. (Default: solved cube)
+        ep : tuple(int), optional
+            Edge cubies at the 12 edge slots. (Default: solved cube)
+        eo : tuple(int), optional
+            Orientations of the edges at the 12 slots. (Default: solved cube)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.cp = list(cp)
+        self.co = list(co)
+        self.ep = list(ep)
+        self.eo = list(eo)
+
+    # -------------------------------------------------------------------------
+
+    def from_state(state):
+        """
+        Create cubie cube from a state of the Rubik's cube gym (class State).
+
+        Parameters
+        ----------
+        state : State
+            Rubik's cube state with corner and edge positions and orientations.
+
+        Returns
+        -------
+        CubieCube
+            Cube with same cubie permutations and orientations.
+
+        """
+        return CubieCube(state.corner_positions, state.corner_orientations,
+                         state.edge_positions, state.edge_orientations)
+
+    # ========== Apply moves ==================================================
+
+    def apply_move(self, move):
+        """
+        Apply a move (index in [0, 17]) to the cube.
+
+        Parameters
+        ----------
+        move : int
+            Move index (3 * face + power).
+
+        Returns
+        -------
+        None.
+
+        """
+        cp, co, ep, eo = CubieCube.MOVE_CUBIES[move]
+        self.co = [(self.co[p] + o) % 3 for p, o in zip(cp, co)]
+        self.cp = [self.cp[p] for p in cp]
+        self.eo = [(self.eo[p] + o) % 2 for p, o in zip(ep, eo)]
+        self.ep = [self.ep[p] for p in ep]
+
+    # -------------------------------------------------------------------------
+
+    def _create_move_cubies():
+        """
+        Create the cubie permutations of all 18 moves.
+
+        Returns
+        -------
+        tuple
+            Tuple (cp, co, ep, eo) for each move index.
+
+        """
+        moves = []
+        for turn in CubieCube.__face_turns:
+            cube = (tuple(range(8)), (0,)*8, tuple(range(12)), (0,)*12)
+            for _ in range(3):
+                cp = tuple(cube[0][i] for i in turn[0])
+                co = tuple((cube[1][p] + o) % 3 for p, o in zip(turn[0], turn[1]))
+                ep = tuple(cube[2][i] for i in turn[2])
+                eo = tuple((cube[3][p] + o) % 2 for p, o in zip(turn[2], turn[3]))
+                cube = (cp, co, ep, eo)
+                moves.append(cube)
+        return tuple(moves)
+
+    # ========== Coordinates of a single cube =================================
+
+    def get_phase1_coordinates(self):
+        """
+        Get twist, flip, and slice coordinate.
+        """
+        twist = int(CubieCube.twist(np.array([self.co]))[0])
+        flip = int(CubieCube.flip(np.array([self.eo]))[0])
+        slice_ = int(CubieCube.slice(np.array([self.ep]))[0])
+        return twist, flip, slice_
+
+    def get_corners_coordinate(self):
+        """
+        Get corner permutation coordinate (valid for any cube).
+        """
+        return int(CubieCube.corners(np.array([self.cp]))[0])
+
+    def get_phase2_edge_coordinates(self):
+        """
+        Get the U/D edge and slice permutation coordinates (valid in phase 2 only).
+        """
+        ep = np.array([self.ep])
+        return int(CubieCube.ud_edges(ep)[0]), int(CubieCube.slice_permutation(ep)[0])
+
+    # ========== Vectorized coordinates =======================================
+
+    # Binomial coefficients C(n, k) for n in [0, 11] and k in [0, 4]
+    __binomial = np.array([[len(list(itertools.combinations(range(n), k))) for k in range(5)] for n in range(12)])
+
+    def twist(co):
+        """
+        Corner orientation coordinate in [0, 2186] of co (shape (N, 8)).
+        """
+        return co[:, :7] @ (3 ** np.arange(6, -1, -1))
+
+    def flip(eo):
+        """
+        Edge orientation coordinate in [0, 2047] of eo (shape (N, 12)).
+        """
+        return eo[:, :11] @ (2 ** np.arange(10, -1, -1))
+
+    def slice(ep):
+        """
+        Coordinate in [0, 494] of the (unordered) UD-slice edge slots of ep (shape (N, 12)).
+        """
+        is_slice = ep >= 8
+        k = np.cumsum(is_slice, axis=1)
+        values = CubieCube.__binomial[np.arange(12), np.minimum(k, 4)]
+        return (values * is_slice).sum(axis=1)
+
+    def corners(cp):
+        """
+        Corner permutation coordinate in [0, 40319] of cp (shape (N, 8)).
+        """
+        return CubieCube._rank_permutations(cp)
+
+    def ud_edges(ep):
+        """
+        Permutation coordinate in [0, 40319] of the U and D edges (phase 2 only).
+        """
+        return CubieCube._rank_permutations(ep[:, :8])
+
+    def slice_permutation(ep):
+        """
+        Permutation coordinate in [0, 23] of the UD-slice edges (phase 2 only).
+        """
+        return CubieCube._rank_permutations(ep[:, 8:] - 8)
+
+    # -------------------------------------------------------------------------
+
+    def _rank_permutations(permutations):
+        """
+        Lehmer ranks of permutations (shape (N, n)), 0 for the identity.
+        """
+        n = permutations.shape[1]
+        ranks = np.zeros(len(permutations), dtype=np.int64)
+        for i in range(n - 1):
+            smaller = (permutations[:, i + 1:] < permutations[:, i:i + 1]).sum(axis=1)
+            ranks = ranks * (n - i) + smaller
+        return ranks
+
+    def _rank_list(permutation):
+        """
+        Lehmer rank of a single permutation given as list.
+        """
+        rank, n = 0, len(permutation)
+        for i in range(n - 1):
+            smaller = 0
+            for j in range(i + 1, n):
+                if permutation[j] < permutation[i]:
+                    smaller += 1
+            rank = rank * (n - i) + smaller
+        return rank
+
+    # -------------------------------------------------------------------------
+
+    def all_orientations(number_cubies, modulo):
+        """
+        Orientation arrays of all twist or flip coordinates in increasing order.
+        """
+        size = modulo ** (number_cubies - 1)
+        values = np.arange(size)
+        digits = np.zeros((size, number_cubies), dtype=np.int64)
+        for i in range(number_cubies - 2, -1, -1):
+            values, digits[:, i] = np.divmod(values, modulo)
+        digits[:, -1] = (-digits.sum(axis=1)) % modulo
+        return digits
+
+    def all_slices():
+        """
+        Edge permutations (slice edges marked by 8) of all slice coordinates in increasing order.
+        """
+        ep = np.zeros((495, 12), dtype=np.int64)
+        for slots in itertools.combinations(range(12), 4):
+            row = np.zeros(12, dtype=np.int64)
+            row[list(slots)] = 8
+            ep[CubieCube.slice(row[None, :])[0]] = row
+        return ep
+
+    def all_permutations(n):
+        """
+        All permutations of range(n) in lexicographic order (i.e., ordered by rank).
+        """
+        return np.array(list(itertools.permutations(range(n))), dtype=np.int64)
+
+# ========== Class-level tables (require the class to be defined) =============
+
+CubieCube.MOVE_CUBIES = CubieCube._create_move_cubies()
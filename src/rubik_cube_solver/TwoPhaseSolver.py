@@ -0,0 +1,307 @@
+"""
+Two-phase solver (H. Kociemba) for Rubik's cubes.
+
+Phase 1 searches move sequences bringing the cube into the subgroup
+<U, D, R2, L2, F2, B2>, phase 2 solves the cube within this subgroup. Both
+phases run IDA* using the pruning tables in class TwoPhaseTables. The search
+continues with longer phase 1 solutions to find shorter overall solutions
+until a solution with at most max_length moves is found or the time budget
+is used up.
+
+The tables are memory-mapped (refer to class TwoPhaseTables), so that several
+solver processes share them and creating a solver takes milliseconds once the
+tables have been generated.
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+# Add Rubik's cube env to path
+import os
+import sys
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'rubik_cube_gym'))
+
+# Other imports
+import time
+from TwoPhaseCube import CubieCube
+from TwoPhaseTables import TwoPhaseTables
+from RCubeState import State
+from PCubeAction import Action
+
+class TwoPhaseSolver:
+
+    # Maximum number of moves searched in phase 2
+    MAX_PHASE2_LENGTH = 11
+
+    # ========== Constructor ==================================================
+
+    def __init__(self, table_dir=None, verbose=True):
+        """
+        Constructor.
+
+        Parameters
+        ----------
+        table_dir : string, optional
+            Directory containing the table files. (Default: TwoPhaseTables.DEFAULT_DIR)
+        verbose : bool, optional
+            Print progress when tables are generated. (Default: True)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.tables = TwoPhaseTables(table_dir, verbose)
+
+        # Memory views provide fast element access (Python int) to memory-mapped tables
+        views = {name: memoryview(table) for name, table in self.tables.tables.items()}
+        self._move_twist = views['move_twist']
+        self._move_flip = views['move_flip']
+        self._move_slice = views['move_slice']
+        self._move_corners = views['move_corners']
+        self._move_ud_edges = views['move_ud_edges']
+        self._move_slice_permutation = views['move_slice_permutation']
+        self._prune_slice_twist = views['prune_slice_twist']
+        self._prune_slice_flip = views['prune_slice_flip']
+        self._prune_twist_flip = views['prune_twist_flip']
+        self._prune_slice_corners = views['prune_slice_corners']
+        self._prune_slice_ud_edges = views['prune_slice_ud_edges']
+
+        # Moves allowed after a move on a face: no same face, opposite faces in fixed order only
+        self._next_moves = []
+        for last_face in range(6):
+            allowed = [m for m in range(18) if (m // 3 != last_face) and (m // 3 != last_face - 3)]
+            self._next_moves.append(allowed)
+        self._next_moves.append(list(range(18)))       # No previous move (face index 6)
+        self._next_phase2_moves = [[m for m in moves if m in CubieCube.PHASE2_MOVES] for moves in self._next_moves]
+
+    # ========== Solve ========================================================
+
+    def solve(self, state, max_length=22, time_budget_s=0.5):
+        """
+        Solve a cube.
+
+        Parameters
+        ----------
+        state : State or CubieCube
+            Cube to solve (Rubik's cube gym state or cubie cube).
+        max_length : int, optional
+            Return as soon as a solution with at most max_length moves is found. (Default: 22)
+        time_budget_s : float, optional
+            Maximum search time in seconds. (Default: 0.5)
+
+        Returns
+        -------
+        list(int) or None
+            Move indices (refer to CubieCube.MOVE_NAMES) of the shortest solution
+            found, or None if no solution has been found within the time budget.
+
+        """
+        cube = CubieCube.from_state(state) if isinstance(state, State) else state
+        self._cube = cube
+        self._deadline_ns = time.perf_counter_ns() + int(time_budget_s * 1e9)
+        self._max_length = max_length
+        self._best = None
+        self._phase1_moves = []
+        self._is_done = False
+
+        twist, flip, slice_ = cube.get_phase1_coordinates()
+        corners = cube.get_corners_coordinate()
+        depth = max(self._prune_slice_twist[slice_ * 2187 + twist], self._prune_slice_flip[slice_ * 2048 + flip],
+                    self._prune_twist_flip[twist * 2048 + flip])
+        while not self._is_done and (depth <= 20):
+            # Phase 1 solutions longer than the best overall solution cannot improve it
+            if (self._best is not None) and (depth >= len(self._best)):
+                break
+            self._search_phase1(twist, flip, slice_, corners, depth, 6)
+            depth += 1
+
+        return self._best
+
+    # -------------------------------------------------------------------------
+
+    def solve_actions(self, state, max_length=22, time_budget_s=0.5):
+        """
+        Solve a cube and return the solution as quarter turn actions (class Action).
+
+        Parameters
+        ----------
+        state : State
+            Cube to solve.
+        max_length : int, optional
+            Maximum length in the solver's move metric (half turns count once). (Default: 22)
+        time_budget_s : float, optional
+            Maximum search time in seconds. (Default: 0.5)
+
+        Returns
+        -------
+        list(Action) or None
+            Actions solving the cube or None if no solution has been found.
+
+        """
+        moves = self.solve(state, max_length, time_budget_s)
+        return None if moves is None else TwoPhaseSolver.moves_to_actions(moves)
+
+    # ========== Phase 1 ======================================================
+
+    def _search_phase1(self, twist, flip, slice_, corners, togo, last_face):
+        """
+        Depth-first search with togo remaining phase 1 moves.
+
+        Returns
+        -------
+        None.
+
+        """
+        if togo == 0:
+            # Phase 1 solved: skip if the last move keeps the cube in phase 2 (shorter phase 1 solution exists)
+            if self._phase1_moves and (self._phase1_moves[-1] in CubieCube.PHASE2_MOVES):
+                return
+            self._start_phase2(corners)
+            return
+
+        move_twist, move_flip, move_slice = self._move_twist, self._move_flip, self._move_slice
+        prune_twist, prune_flip, prune_twist_flip = self._prune_slice_twist, self._prune_slice_flip, self._prune_twist_flip
+        for move in self._next_moves[last_face]:
+            new_twist = move_twist[twist * 18 + move]
+            new_flip = move_flip[flip * 18 + move]
+            new_slice = move_slice[slice_ * 18 + move]
+            distance = prune_twist[new_slice * 2187 + new_twist]
+            if distance >= togo:
+                continue
+            if prune_flip[new_slice * 2048 + new_flip] >= togo:
+                continue
+            if prune_twist_flip[new_twist * 2048 + new_flip] >= togo:
+                continue
+            # Moves leaving phase 1 solved early would be found with smaller togo
+            if (distance == 0) and (togo > 1) and (new_twist == 0) and (new_flip == 0):
+                continue
+
+            self._phase1_moves.append(move)
+            self._search_phase1(new_twist, new_flip, new_slice, self._move_corners[corners * 18 + move],
+                                togo - 1, move // 3)
+            self._phase1_moves.pop()
+            if self._is_done:
+                return
+
+    # ========== Phase 2 ======================================================
+
+    def _start_phase2(self, corners):
+        """
+        Search phase 2 for the cube after the current phase 1 moves.
+
+        Returns
+        -------
+        None.
+
+        """
+        if time.perf_counter_ns() > self._deadline_ns:
+            self._is_done = True
+            return
+
+        # Phase 2 edge coordinates (only defined in phase 2, hence apply phase 1 moves on cubie level)
+        ep = self._cube.ep
+        for move in self._phase1_moves:
+            ep = [ep[p] for p in CubieCube.MOVE_CUBIES[move][2]]
+        ud_edges = CubieCube._rank_list(ep[:8])
+        slice_permutation = CubieCube._rank_list([e - 8 for e in ep[8:]])
+
+        # Maximum phase 2 length to improve best solution (long phase 2 searches are expensive and
+        # solutions of the same length are usually found faster with longer phase 1 solutions)
+        length1 = len(self._phase1_moves)
+        limit = min((len(self._best) - 1 if self._best is not None else 30) - length1, TwoPhaseSolver.MAX_PHASE2_LENGTH)
+        depth = max(self._prune_slice_corners[slice_permutation * 40320 + corners],
+                    self._prune_slice_ud_edges[slice_permutation * 40320 + ud_edges])
+        last_face = self._phase1_moves[-1] // 3 if length1 > 0 else 6
+
+        self._phase2_moves = []
+        while depth <= limit:
+            if self._search_phase2(corners, ud_edges, slice_permutation, depth, last_face):
+                self._best = self._phase1_moves + self._phase2_moves
+                self._is_done = len(self._best) <= self._max_length
+                return
+            depth += 1
+
+    # -------------------------------------------------------------------------
+
+    def _search_phase2(self, corners, ud_edges, slice_permutation, togo, last_face):
+        """
+        Depth-first search with togo remaining phase 2 moves.
+
+        Returns
+        -------
+        bool
+            True if the cube is solved (moves in self._phase2_moves), else False.
+
+        """
+        if togo == 0:
+            return (corners == 0) and (ud_edges == 0) and (slice_permutation == 0)
+
+        move_corners, move_ud_edges, move_slice_permutation = self._move_corners, self._move_ud_edges, self._move_slice_permutation
+        prune_corners, prune_ud_edges = self._prune_slice_corners, self._prune_slice_ud_edges
+        for move in self._next_phase2_moves[last_face]:
+            new_corners = move_corners[corners * 18 + move]
+            new_slice_permutation = move_slice_permutation[slice_permutation * 18 + move]
+            if prune_corners[new_slice_permutation * 40320 + new_corners] >= togo:
+                continue
+            new_ud_edges = move_ud_edges[ud_edges * 18 + move]
+            if prune_ud_edges[new_slice_permutation * 40320 + new_ud_edges] >= togo:
+                continue
+
+            self._phase2_moves.append(move)
+            if self._search_phase2(new_corners, new_ud_edges, new_slice_permutation, togo - 1, move // 3):
+                return True
+            self._phase2_moves.pop()
+        return False
+
+    # ========== Conversions ==================================================
+
+    def moves_to_string(moves):
+        """
+        Get a solution as string, e.g. "R U2 F'".
+        """
+        return ' '.join(CubieCube.MOVE_NAMES[move] for move in moves)
+
+    # -------------------------------------------------------------------------
+
+    def moves_to_actions(moves):
+        """
+        Get a solution as quarter turn actions (half turns result in two actions).
+        """
+        clockwise = (Action.U, Action.R, Action.F, Action.D, Action.L, Action.B)
+        actions = []
+        for move in moves:
+            face, power = divmod(move, 3)
+            if power == 0:
+                actions.append(clockwise[face])
+            elif power == 1:
+                actions += [clockwise[face], clockwise[face]]
+            else:
+                actions.append(clockwise[face].inverse_action())
+        return actions
+
+# -----------------------------------------------------------------------------
+# Main (sample)
+# -----------------------------------------------------------------------------
+
+if __name__ == '__main__':
+    import random
+
+    solver = TwoPhaseSolver()
+
+    for _ in range(5):
+        # Scramble cube randomly
+        state = State()
+        for _ in range(40):
+            state = state.next_state(random.choice(list(Action)))
+
+        # Solve and verify
+        start_time_ns = time.perf_counter_ns()
+        moves = solver.solve(state, max_length=21, time_budget_s=0.5)
+        time_ms = (time.perf_counter_ns() - start_time_ns) / 1e6
+        for action in TwoPhaseSolver.moves_to_actions(moves):
+            state = state.next_state(action)
+        print(f'{len(moves)} moves in {time_ms:.1f} ms (solved: {state.is_cube_solved()}): {TwoPhaseSolver.moves_to_string(moves)}')
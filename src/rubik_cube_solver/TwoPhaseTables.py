@@ -0,0 +1,258 @@
+"""
+Move and pruning tables of the two-phase solver for Rubik's cubes.
+
+The tables are generated once and stored as .npy files. Afterwards, they are
+opened as memory-mapped files, so that loading takes no time and all solver
+processes on a machine share the same physical pages (via the page cache).
+
+Tables (number of entries):
+- Phase 1 move tables: twist (2187 x 18), flip (2048 x 18), slice (495 x 18)
+- Phase 2 move tables: corners (40320 x 18), U/D edges (40320 x 18), slice permutation (24 x 18)
+- Phase 1 pruning tables: slice x twist (1,082,565), slice x flip (1,013,760), twist x flip (4,478,976)
+- Phase 2 pruning tables: slice permutation x corners, slice permutation x U/D edges (967,680 each)
+
+@authors: Marc Hensel
+@contact: http://www.haw-hamburg.de/marc-hensel
+@copyright: 2026
+@version: 2026.10.18
+@license: CC BY-NC-SA 4.0, see https://creativecommons.org/licenses/by-nc-sa/4.0/deed.en
+"""
+
+import os
+import time
+import numpy as np
+from TwoPhaseCube import CubieCube
+
+class TwoPhaseTables:
+
+    # ========== Constructor ==================================================
+
+    # Default directory to store tables in
+    DEFAULT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'tables')
+
+    # Table names and generator methods
+    __generators = {
+        'move_twist': '_generate_move_twist',
+        'move_flip': '_generate_move_flip',
+        'move_slice': '_generate_move_slice',
+        'move_corners': '_generate_move_corners',
+        'move_ud_edges': '_generate_move_ud_edges',
+        'move_slice_permutation': '_generate_move_slice_permutation',
+        'prune_slice_twist': '_generate_prune_slice_twist',
+        'prune_slice_flip': '_generate_prune_slice_flip',
+        'prune_twist_flip': '_generate_prune_twist_flip',
+        'prune_slice_corners': '_generate_prune_slice_corners',
+        'prune_slice_ud_edges': '_generate_prune_slice_ud_edges'
+    }
+
+    def __init__(self, table_dir=None, verbose=True):
+        """
+        Constructor. Opens all tables, generating missing ones.
+
+        Parameters
+        ----------
+        table_dir : string, optional
+            Directory containing the table files. (Default: DEFAULT_DIR)
+        verbose : bool, optional
+            Print progress when tables are generated. (Default: True)
+
+        Returns
+        -------
+        None.
+
+        """
+        self.table_dir = TwoPhaseTables.DEFAULT_DIR if table_dir is None else table_dir
+        self.verbose = verbose
+        self.tables = {}
+        for name in TwoPhaseTables.__generators:
+            self.tables[name] = self._open(name)
+
+    # ========== File I/O =====================================================
+
+    def _file_name(self, name):
+        return os.path.join(self.table_dir, name + '.npy')
+
+    # -------------------------------------------------------------------------
+
+    def _open(self, name):
+        """
+        Open a table as memory-mapped file (generate and store it, first, if missing).
+
+        Parameters
+        ----------
+        name : string
+            Name of the table.
+
+        Returns
+        -------
+        numpy.memmap
+            Flat read-only table.
+
+        """
+        file_name = self._file_name(name)
+        if not os.path.exists(file_name):
+            if self.verbose:
+                print(f'Generating two-phase table {name} ... ', end='', flush=True)
+            start_time_ns = time.time_ns()
+            table = getattr(self, TwoPhaseTables.__generators[name])()
+            self._save_atomic(file_name, np.ascontiguousarray(table.ravel()))
+            if self.verbose:
+                print(f'ok ({(time.time_ns() - start_time_ns) / 1e9:.1f} s)')
+        return np.load(file_name, mmap_mode='r')
+
+    # -------------------------------------------------------------------------
+
+    def _save_atomic(self, file_name, table):
+        """
+        Save table so that concurrent processes never see partially written files.
+        """
+        os.makedirs(self.table_dir, exist_ok=True)
+        temp_name = f'{file_name}.{os.getpid()}.tmp'
+        with open(temp_name, 'wb') as file:
+            np.save(file, table)
+        os.replace(temp_name, file_name)
+
+    # -------------------------------------------------------------------------
+
+    def memory_size(self):
+        """
+        Get total size of all tables in bytes.
+        """
+        return sum(table.nbytes for table in self.tables.values())
+
+    # -------------------------------------------------------------------------
+
+    def memory_stats(self):
+        """
+        Get memory statistics of the tables (memory-mapped, i.e., shared between processes).
+        """
+        return {'bytes': self.memory_size(), 'entries': sum(table.size for table in self.tables.values()), 'shared': True}
+
+    # ========== Move tables ==================================================
+
+    def _move_table(cubes, apply_move, coordinate, moves=range(18), dtype=np.uint16):
+        """
+        Create a move table by applying moves to all cubes representing the coordinate values.
+
+        Parameters
+        ----------
+        cubes : numpy.ndarray
+            Cubie arrays (one row per coordinate value, ordered by coordinate).
+        apply_move : function
+            Function (cubes, move cubies) returning the moved cubie arrays.
+        coordinate : function
+            Vectorized coordinate function.
+        moves : iterable(int), optional
+            Moves to create table columns for (others remain 0). (Default: all)
+        dtype : numpy.dtype, optional
+            Type of the table entries. (Default: numpy.uint16)
+
+        Returns
+        -------
+        numpy.ndarray of shape (number values, 18)
+            Move table.
+
+        """
+        table = np.zeros((len(cubes), CubieCube.NUMBER_MOVES), dtype=dtype)
+        for move in moves:
+            table[:, move] = coordinate(apply_move(cubes, CubieCube.MOVE_CUBIES[move]))
+        return table
+
+    def _generate_move_twist(self):
+        co = CubieCube.all_orientations(8, 3)
+        return TwoPhaseTables._move_table(co, lambda c, m: (c[:, m[0]] + m[1]) % 3, CubieCube.twist)
+
+    def _generate_move_flip(self):
+        eo = CubieCube.all_orientations(12, 2)
+        return TwoPhaseTables._move_table(eo, lambda e, m: (e[:, m[2]] + m[3]) % 2, CubieCube.flip)
+
+    def _generate_move_slice(self):
+        ep = CubieCube.all_slices()
+        return TwoPhaseTables._move_table(ep, lambda e, m: e[:, m[2]], CubieCube.slice)
+
+    def _generate_move_corners(self):
+        cp = CubieCube.all_permutations(8)
+        return TwoPhaseTables._move_table(cp, lambda c, m: c[:, m[0]], CubieCube.corners)
+
+    def _generate_move_ud_edges(self):
+        ep = np.hstack((CubieCube.all_permutations(8), np.tile(np.arange(8, 12), (40320, 1))))
+        return TwoPhaseTables._move_table(ep, lambda e, m: e[:, m[2]], CubieCube.ud_edges, CubieCube.PHASE2_MOVES)
+
+    def _generate_move_slice_permutation(self):
+        ep = np.hstack((np.tile(np.arange(8), (24, 1)), CubieCube.all_permutations(4) + 8))
+        return TwoPhaseTables._move_table(ep, lambda e, m: e[:, m[2]], CubieCube.slice_permutation,
+                                          CubieCube.PHASE2_MOVES, dtype=np.uint8)
+
+    # ========== Pruning tables ===============================================
+
+    def _pruning_table(move_a, move_b, start, moves):
+        """
+        Breadth-first search for the distances in the product space of two coordinates.
+
+        The table index is <coordinate a> * <size b> + <coordinate b>.
+
+        Parameters
+        ----------
+        move_a : numpy.ndarray of shape (size a, 18)
+            Move table of coordinate a.
+        move_b : numpy.ndarray of shape (size b, 18)
+            Move table of coordinate b.
+        start : int
+            Table index of the target (solved) coordinate pair.
+        moves : tuple(int)
+            Moves allowed in the phase.
+
+        Returns
+        -------
+        numpy.ndarray of dtype int8
+            Minimum number of moves to reach the target.
+
+        """
+        size_b = len(move_b)
+        moves = np.array(moves)
+        move_a = move_a[:, moves].astype(np.int64)
+        move_b = move_b[:, moves].astype(np.int64)
+
+        distances = np.full(len(move_a) * size_b, -1, dtype=np.int8)
+        distances[start] = 0
+        frontier = np.array([start], dtype=np.int64)
+        depth = 0
+        while frontier.size > 0:
+            a, b = np.divmod(frontier, size_b)
+            successors = (move_a[a] * size_b + move_b[b]).ravel()
+            depth += 1
+            distances[successors[distances[successors] < 0]] = depth
+            frontier = np.flatnonzero(distances == depth)
+        return distances
+
+    def _generate_prune_slice_twist(self):
+        return TwoPhaseTables._pruning_table(self._load_2d('move_slice'), self._load_2d('move_twist'),
+                                             TwoPhaseTables.SOLVED_SLICE * 2187, range(18))
+
+    def _generate_prune_slice_flip(self):
+        return TwoPhaseTables._pruning_table(self._load_2d('move_slice'), self._load_2d('move_flip'),
+                                             TwoPhaseTables.SOLVED_SLICE * 2048, range(18))
+
+    def _generate_prune_twist_flip(self):
+        return TwoPhaseTables._pruning_table(self._load_2d('move_twist'), self._load_2d('move_flip'), 0, range(18))
+
+    def _generate_prune_slice_corners(self):
+        return TwoPhaseTables._pruning_table(self._load_2d('move_slice_permutation'), self._load_2d('move_corners'),
+                                             0, CubieCube.PHASE2_MOVES)
+
+    def _generate_prune_slice_ud_edges(self):
+        return TwoPhaseTables._pruning_table(self._load_2d('move_slice_permutation'), self._load_2d('move_ud_edges'),
+                                             0, CubieCube.PHASE2_MOVES)
+
+    # -------------------------------------------------------------------------
+
+    def _load_2d(self, name):
+        """
+        Get a move table as array of shape (number values, 18).
+        """
+        table = self.tables[name] if name in self.tables else self._open(name)
+        return np.asarray(table).reshape(-1, CubieCube.NUMBER_MOVES)
+
+# ========== Class-level constants ============================================
+
+TwoPhaseTables.SOLVED_SLICE = int(CubieCube.slice(np.arange(12)[None, :])[0])